@@ -0,0 +1,134 @@
+// Tests asynchronous execution of in situ pipelines. The analysis takes longer
+// on some ranks than on others, so ranks see their worker as busy at different
+// times. Timesteps must still be skipped or executed consistently on all ranks,
+// otherwise the collective operations in the pipelines never match up.
+
+#include "vtkInSituInitializationHelper.h"
+#include "vtkInSituPipeline.h"
+#include "vtkMPI.h"
+#include "vtkMultiProcessController.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+class vtkTestInSituPipeline : public vtkInSituPipeline
+{
+public:
+  static vtkTestInSituPipeline* New();
+  vtkTypeMacro(vtkTestInSituPipeline, vtkInSituPipeline);
+
+  bool Execute(int timestep, double vtkNotUsed(time)) override
+  {
+    auto controller = vtkMultiProcessController::GetGlobalController();
+    const int rank = controller ? controller->GetLocalProcessId() : 0;
+
+    // make the analysis slower on higher ranks.
+    std::this_thread::sleep_for(std::chrono::milliseconds(5 + 20 * rank));
+
+    // collective operation, as done by any distributed analysis pipeline.
+    int minTimeStep = timestep;
+    int maxTimeStep = timestep;
+    if (controller)
+    {
+      controller->AllReduce(&timestep, &minTimeStep, 1, vtkCommunicator::MIN_OP);
+      controller->AllReduce(&timestep, &maxTimeStep, 1, vtkCommunicator::MAX_OP);
+    }
+    if (minTimeStep != timestep || maxTimeStep != timestep)
+    {
+      this->Mismatch = true;
+    }
+    this->ExecutedTimeSteps.push_back(timestep);
+    return true;
+  }
+
+  std::vector<int> ExecutedTimeSteps;
+  bool Mismatch = false;
+
+protected:
+  vtkTestInSituPipeline() = default;
+  ~vtkTestInSituPipeline() override = default;
+
+private:
+  vtkTestInSituPipeline(const vtkTestInSituPipeline&) = delete;
+  void operator=(const vtkTestInSituPipeline&) = delete;
+};
+vtkStandardNewMacro(vtkTestInSituPipeline);
+}
+
+int TestInSituAsynchronousExecution(int argc, char* argv[])
+{
+  int provided = MPI_THREAD_SINGLE;
+  MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &provided);
+  int rank = 0;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+  vtkInSituInitializationHelper::SetAsynchronousExecution(true);
+  vtkInSituInitializationHelper::SetMaximumNumberOfSkippedTimeSteps(-1);
+  vtkInSituInitializationHelper::Initialize(MPI_Comm_c2f(MPI_COMM_WORLD));
+
+  const bool async = vtkInSituInitializationHelper::GetAsynchronousExecution();
+  if (provided >= MPI_THREAD_MULTIPLE && !async)
+  {
+    std::cerr << "ERROR: asynchronous execution was unexpectedly disabled." << std::endl;
+    MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+  }
+
+  vtkNew<vtkTestInSituPipeline> pipeline;
+  vtkInSituInitializationHelper::AddPipeline(pipeline);
+
+  const int numberOfTimeSteps = 20;
+  std::vector<int> skipped;
+  for (int timestep = 0; timestep < numberOfTimeSteps; ++timestep)
+  {
+    if (vtkInSituInitializationHelper::ShouldSkipTimeStep(timestep))
+    {
+      skipped.push_back(timestep);
+      continue;
+    }
+    vtkInSituInitializationHelper::ExecutePipelines(timestep, 0.1 * timestep);
+  }
+  vtkInSituInitializationHelper::Finalize();
+
+  int status = EXIT_SUCCESS;
+  const int numberOfExecuted = static_cast<int>(pipeline->ExecutedTimeSteps.size());
+  if (numberOfExecuted + static_cast<int>(skipped.size()) != numberOfTimeSteps)
+  {
+    std::cerr << "ERROR: rank " << rank << " executed " << numberOfExecuted << " and skipped "
+              << skipped.size() << " of " << numberOfTimeSteps << " timesteps." << std::endl;
+    status = EXIT_FAILURE;
+  }
+  if (pipeline->Mismatch)
+  {
+    std::cerr << "ERROR: rank " << rank << " executed timesteps other ranks did not."
+              << std::endl;
+    status = EXIT_FAILURE;
+  }
+  if (!async && !skipped.empty())
+  {
+    std::cerr << "ERROR: timesteps skipped in synchronous mode." << std::endl;
+    status = EXIT_FAILURE;
+  }
+
+  // all ranks must have skipped exactly the same timesteps.
+  int localCount = static_cast<int>(skipped.size());
+  int minCount = 0;
+  int maxCount = 0;
+  MPI_Allreduce(&localCount, &minCount, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+  MPI_Allreduce(&localCount, &maxCount, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+  if (minCount != maxCount)
+  {
+    std::cerr << "ERROR: ranks skipped different numbers of timesteps." << std::endl;
+    status = EXIT_FAILURE;
+  }
+
+  int globalStatus = EXIT_SUCCESS;
+  MPI_Allreduce(&status, &globalStatus, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+  MPI_Finalize();
+  return globalStatus;
+}
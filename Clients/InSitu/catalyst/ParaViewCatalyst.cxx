@@ -49,6 +49,27 @@
 
 #include "catalyst_impl_paraview.h"
 
+#include <functional>
+#include <memory>
+
+namespace
+{
+// When pipelines are executed asynchronously, the channel nodes passed to
+// `catalyst_execute` are no longer valid once the call returns. They are copied
+// into one of these buffers and the producers are pointed to the copy instead.
+// Two buffers let the next timestep be copied while the analysis is still
+// reading the previous one.
+struct AsynchronousBuffers
+{
+  conduit_cpp::Node Buffers[2];
+  int Front = 0;
+
+  conduit_cpp::Node& Back() { return this->Buffers[1 - this->Front]; }
+  void Swap() { this->Front = 1 - this->Front; }
+};
+std::unique_ptr<AsynchronousBuffers> async_buffers;
+}
+
 static bool update_producer_mesh_blueprint(const std::string& channel_name,
   const conduit_node* node, const conduit_node* global_fields, bool multimesh,
   const conduit_node* assemblyNode, bool multiblock)
@@ -264,7 +285,24 @@ enum catalyst_status catalyst_initialize_paraview(const conduit_node* params)
 #else
   const vtkTypeUInt64 comm = 0;
 #endif
+
+  if (cpp_params.has_path("catalyst/async/enabled"))
+  {
+    vtkInSituInitializationHelper::SetAsynchronousExecution(
+      cpp_params["catalyst/async/enabled"].to_int() != 0);
+  }
+  if (cpp_params.has_path("catalyst/async/max_skipped_timesteps"))
+  {
+    vtkInSituInitializationHelper::SetMaximumNumberOfSkippedTimeSteps(
+      cpp_params["catalyst/async/max_skipped_timesteps"].to_int());
+  }
+
   vtkInSituInitializationHelper::Initialize(comm);
+  if (vtkInSituInitializationHelper::GetAsynchronousExecution())
+  {
+    vtkVLogF(PARAVIEW_LOG_CATALYST_VERBOSITY(), "Analysis pipelines will execute asynchronously.");
+    async_buffers.reset(new AsynchronousBuffers());
+  }
 
   if (cpp_params.has_path("catalyst/scripts"))
   {
@@ -384,6 +422,34 @@ enum catalyst_status catalyst_execute_paraview(const conduit_node* params)
   vtkVLogScopeF(
     PARAVIEW_LOG_CATALYST_VERBOSITY(), "co-processing for timestep=%d, time=%f", timestep, time);
 
+  // Fides channels read directly from the simulation's ADIOS engine and hence
+  // cannot be buffered. Such timesteps are neither skipped nor overlapped with
+  // the simulation.
+  bool has_fides_channel = false;
+  if (root.has_child("channels"))
+  {
+    const auto channels = root["channels"];
+    for (conduit_index_t i = 0, max = channels.number_of_children(); i < max; ++i)
+    {
+      has_fides_channel |= (channels.child(i)["type"].as_string() == "fides");
+    }
+  }
+
+  if (!has_fides_channel && vtkInSituInitializationHelper::ShouldSkipTimeStep(timestep))
+  {
+    return catalyst_status_ok;
+  }
+
+  conduit_cpp::Node* buffer = nullptr;
+  if (async_buffers)
+  {
+    buffer = &async_buffers->Back();
+    buffer->reset();
+  }
+
+  // producers may still be in use by the analysis of the previous timestep
+  // when executing asynchronously; updates are deferred till it is done.
+  std::vector<std::function<void()>> producer_updates;
   conduit_cpp::Node globalFields;
 
   // catalyst/channels are used to communicate meshes.
@@ -488,25 +554,55 @@ enum catalyst_status catalyst_execute_paraview(const conduit_node* params)
       fields["timestep"].set(channel_timestep);
       fields["cycle"].set(channel_timestep);
       fields["channel"].set(channel_name);
-      if (type == "mesh" || type == "multimesh")
+
+      const conduit_node* data_ptr = conduit_cpp::c_node(&data_node);
+      const conduit_node* fields_ptr = conduit_cpp::c_node(&fields);
+      const conduit_node* assembly_ptr = nullptr;
+      if (channel_node.has_path("assembly"))
       {
-        conduit_node* assembly = nullptr;
-        if (channel_node.has_path("assembly"))
+        auto anode = channel_node["assembly"];
+        assembly_ptr = conduit_cpp::c_node(&anode);
+      }
+
+      if (buffer != nullptr && type != "fides")
+      {
+        auto channel_copy = (*buffer)[channel_name];
+        auto data_copy = channel_copy["data"];
+        data_copy.set(data_node);
+        data_ptr = conduit_cpp::c_node(&data_copy);
+        auto fields_copy = channel_copy["fields"];
+        fields_copy.set(fields);
+        fields_ptr = conduit_cpp::c_node(&fields_copy);
+        if (assembly_ptr != nullptr)
         {
-          auto anode = channel_node["assembly"];
-          assembly = conduit_cpp::c_node(&anode);
+          auto assembly_copy = channel_copy["assembly"];
+          assembly_copy.set(channel_node["assembly"]);
+          assembly_ptr = conduit_cpp::c_node(&assembly_copy);
         }
-        update_producer_mesh_blueprint(channel_name, conduit_cpp::c_node(&data_node),
-          conduit_cpp::c_node(&fields), type == "multimesh", assembly,
-          channel_output_multiblock != 0);
+      }
+
+      if (type == "mesh" || type == "multimesh")
+      {
+        const bool multimesh = (type == "multimesh");
+        const bool multiblock = (channel_output_multiblock != 0);
+        producer_updates.emplace_back([=]() {
+          update_producer_mesh_blueprint(
+            channel_name, data_ptr, fields_ptr, multimesh, assembly_ptr, multiblock);
+        });
       }
       else if (type == "ioss")
       {
-        update_producer_ioss(channel_name, &data_node, &fields);
+        producer_updates.emplace_back([=]() {
+          const auto data_cpp = conduit_cpp::cpp_node(const_cast<conduit_node*>(data_ptr));
+          const auto fields_cpp = conduit_cpp::cpp_node(const_cast<conduit_node*>(fields_ptr));
+          update_producer_ioss(channel_name, &data_cpp, &fields_cpp);
+        });
       }
       else if (type == "fides")
       {
-        update_producer_fides(channel_name, time);
+        producer_updates.emplace_back([channel_name, &time]() {
+          update_producer_fides(channel_name, time);
+        });
       }
     }
   }
@@ -527,7 +623,21 @@ enum catalyst_status catalyst_execute_paraview(const conduit_node* params)
       parameters.push_back(state_parameters.child(i).as_string());
     }
   }
+
+  vtkInSituInitializationHelper::WaitForPipelines();
+  if (async_buffers)
+  {
+    async_buffers->Swap();
+  }
+  for (const auto& update : producer_updates)
+  {
+    update();
+  }
   vtkInSituInitializationHelper::ExecutePipelines(timestep, time, parameters);
+  if (has_fides_channel)
+  {
+    vtkInSituInitializationHelper::WaitForPipelines();
+  }
 
   return catalyst_status_ok;
 }
@@ -545,6 +655,7 @@ enum catalyst_status catalyst_finalize_paraview(const conduit_node* params)
   }
 
   vtkInSituInitializationHelper::Finalize();
+  async_buffers.reset();
 
   return catalyst_status_ok;
 }
@@ -577,6 +688,9 @@ enum catalyst_status catalyst_results_paraview(conduit_node* params)
   conduit_cpp::Node cpp_params = conduit_cpp::cpp_node(params);
   auto catalyst_node = cpp_params["catalyst"];
 
+  // steerable proxies may be updated by pipelines still executing.
+  vtkInSituInitializationHelper::WaitForPipelines();
+
   bool is_success = true;
   std::vector<std::pair<std::string, vtkSMProxy*>> steerableProxies;
   vtkInSituInitializationHelper::GetSteerableProxies(steerableProxies);
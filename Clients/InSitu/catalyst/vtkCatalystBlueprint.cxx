@@ -229,6 +229,26 @@ bool verify(const std::string& protocol, const conduit_cpp::Node& n)
       return false;
     }
   }
+  if (n.has_child("async"))
+  {
+    const auto async = n["async"];
+    if (!async.dtype().is_object())
+    {
+      vtkLogF(ERROR, "'async' must be an 'object'.");
+      return false;
+    }
+    if (async.has_child("enabled") && !async["enabled"].dtype().is_integer())
+    {
+      vtkLogF(ERROR, "'async/enabled' must be an integer.");
+      return false;
+    }
+    if (async.has_child("max_skipped_timesteps") &&
+      !async["max_skipped_timesteps"].dtype().is_integer())
+    {
+      vtkLogF(ERROR, "'async/max_skipped_timesteps' must be an integer.");
+      return false;
+    }
+  }
   return true;
 }
 
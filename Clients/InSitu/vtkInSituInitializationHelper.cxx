@@ -43,8 +43,11 @@
 
 #include <algorithm>
 #include <cctype>
+#include <condition_variable>
 #include <map>
+#include <mutex>
 #include <string>
+#include <thread>
 
 #if VTK_MODULE_ENABLE_ParaView_PythonCatalyst
 extern "C"
@@ -72,9 +75,30 @@ public:
     bool ExecuteFailed;
   };
 
+  ~vtkInternals()
+  {
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+    this->MPIController = nullptr;
+    if (this->AsynchronousComm != MPI_COMM_NULL)
+    {
+      MPI_Comm_free(&this->AsynchronousComm);
+    }
+    if (this->DecisionComm != MPI_COMM_NULL)
+    {
+      MPI_Comm_free(&this->DecisionComm);
+    }
+#endif
+  }
+
   vtkSmartPointer<vtkCPCxxHelper> CPCxxHelper;
 #if VTK_MODULE_ENABLE_VTK_ParallelMPI
   vtkSmartPointer<vtkMPIController> MPIController;
+  // duplicate of the simulation communicator used when executing pipelines
+  // asynchronously.
+  MPI_Comm AsynchronousComm = MPI_COMM_NULL;
+  // duplicate of the simulation communicator used by the simulation thread to
+  // agree on skipping timesteps when executing pipelines asynchronously.
+  MPI_Comm DecisionComm = MPI_COMM_NULL;
 #endif
   std::map<std::string, vtkSmartPointer<vtkSMSourceProxy>> Producers;
   std::vector<PipelineInfo> Pipelines;
@@ -83,6 +107,17 @@ public:
   bool InExecutePipelines = false;
   int TimeStep = 0;
   double Time = 0.0;
+
+  // state used for asynchronous execution. `Busy` is true from the time a
+  // request is handed off to the worker thread till all pipelines have been
+  // executed for it.
+  std::thread Worker;
+  std::mutex Mutex;
+  std::condition_variable Condition;
+  bool Busy = false;
+  bool TerminateWorker = false;
+  int SkippedTimeSteps = 0;
+  std::vector<std::string> Parameters;
 };
 
 template <typename PropertyType>
@@ -121,6 +156,8 @@ void SetPropertyValue(T* prop, vtkDataArray* array)
 
 int vtkInSituInitializationHelper::WasInitializedOnce;
 int vtkInSituInitializationHelper::WasFinalizedOnce;
+bool vtkInSituInitializationHelper::AsynchronousExecution = false;
+int vtkInSituInitializationHelper::MaximumNumberOfSkippedTimeSteps = 0;
 vtkInSituInitializationHelper::vtkInternals* vtkInSituInitializationHelper::Internals;
 //----------------------------------------------------------------------------
 vtkInSituInitializationHelper::vtkInSituInitializationHelper() = default;
@@ -142,6 +179,27 @@ void vtkInSituInitializationHelper::Initialize(vtkTypeUInt64 comm)
       PARAVIEW_LOG_CATALYST_VERBOSITY(), "Initializing MPI communicator using 'comm' (%llu)", comm);
     // convert comm to MPI handle.
     MPI_Comm mpicomm = MPI_Comm_f2c(comm);
+    if (vtkInSituInitializationHelper::AsynchronousExecution)
+    {
+      int provided = MPI_THREAD_SINGLE;
+      MPI_Query_thread(&provided);
+      if (provided < MPI_THREAD_MULTIPLE)
+      {
+        vtkLogF(WARNING,
+          "Asynchronous execution requires MPI to be initialized with 'MPI_THREAD_MULTIPLE'. "
+          "Pipelines will be executed synchronously.");
+        vtkInSituInitializationHelper::AsynchronousExecution = false;
+      }
+      else
+      {
+        // the analysis communicates from the worker thread while the
+        // simulation continues; use a separate communicator to ensure
+        // messages from the two never match.
+        MPI_Comm_dup(mpicomm, &internals.AsynchronousComm);
+        MPI_Comm_dup(mpicomm, &internals.DecisionComm);
+        mpicomm = internals.AsynchronousComm;
+      }
+    }
     vtkMPICommunicatorOpaqueComm opaqueComm(&mpicomm);
     vtkNew<vtkMPICommunicator> mpiCommunicator;
     mpiCommunicator->InitializeExternal(&opaqueComm);
@@ -207,8 +265,20 @@ void vtkInSituInitializationHelper::Finalize()
     return;
   }
 
+  // drain any analysis still in progress and stop the worker thread.
+  auto& internals = (*vtkInSituInitializationHelper::Internals);
+  if (internals.Worker.joinable())
+  {
+    {
+      std::unique_lock<std::mutex> lock(internals.Mutex);
+      internals.Condition.wait(lock, [&internals]() { return !internals.Busy; });
+      internals.TerminateWorker = true;
+    }
+    internals.Condition.notify_all();
+    internals.Worker.join();
+  }
+
   // finalize pipelines.
-  const auto& internals = (*vtkInSituInitializationHelper::Internals);
   for (auto& item : internals.Pipelines)
   {
     if (item.Initialized && !item.InitializationFailed)
@@ -285,6 +355,8 @@ void vtkInSituInitializationHelper::SetProducer(
     return;
   }
 
+  vtkInSituInitializationHelper::WaitForPipelines();
+
   vtkNew<vtkSMParaViewPipelineController> contoller;
   contoller->RegisterPipelineProxy(producer, channelName.c_str());
   internals.Producers[channelName] = producer;
@@ -339,6 +411,7 @@ void vtkInSituInitializationHelper::MarkProducerModified(vtkSMSourceProxy* produ
     return;
   }
 
+  vtkInSituInitializationHelper::WaitForPipelines();
   producer->UpdateVTKObjects();
   if (auto obj = vtkObject::SafeDownCast(producer->GetClientSideObject()))
   {
@@ -360,18 +433,52 @@ bool vtkInSituInitializationHelper::ExecutePipelines(
   }
 
   auto& internals = (*vtkInSituInitializationHelper::Internals);
-  if (internals.InExecutePipelines)
+  if ((!vtkInSituInitializationHelper::AsynchronousExecution ||
+        std::this_thread::get_id() == internals.Worker.get_id()) &&
+    internals.InExecutePipelines)
   {
     vtkLogF(ERROR, "Recursive call to 'ExecutePipelines' not supported!");
     return false;
   }
 
+  // in asynchronous mode, the previous timestep must be done before the
+  // pipelines can be touched again.
+  vtkInSituInitializationHelper::WaitForPipelines();
+
   internals.InExecutePipelines = true;
   internals.TimeStep = timestep;
   internals.Time = time;
 
   UpdateSteerableProxies();
 
+  if (!vtkInSituInitializationHelper::AsynchronousExecution)
+  {
+    vtkInSituInitializationHelper::RunPipelines(timestep, time, parameters);
+    internals.InExecutePipelines = false;
+    return true;
+  }
+
+  vtkVLogF(PARAVIEW_LOG_CATALYST_VERBOSITY(),
+    "handing off pipelines for timestep=%d to the worker thread", timestep);
+  {
+    std::lock_guard<std::mutex> lock(internals.Mutex);
+    internals.Parameters = parameters;
+    internals.SkippedTimeSteps = 0;
+    internals.Busy = true;
+    if (!internals.Worker.joinable())
+    {
+      internals.Worker = std::thread(&vtkInSituInitializationHelper::AsynchronousWorker);
+    }
+  }
+  internals.Condition.notify_all();
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void vtkInSituInitializationHelper::RunPipelines(
+  int timestep, double time, const std::vector<std::string>& parameters)
+{
+  auto& internals = (*vtkInSituInitializationHelper::Internals);
   for (auto& item : internals.Pipelines)
   {
     if (!item.Initialized)
@@ -394,11 +501,137 @@ bool vtkInSituInitializationHelper::ExecutePipelines(
       item.ExecuteFailed = !item.Pipeline->Execute(timestep, time);
     }
   }
+}
+
+//----------------------------------------------------------------------------
+void vtkInSituInitializationHelper::AsynchronousWorker()
+{
+  auto& internals = (*vtkInSituInitializationHelper::Internals);
+  std::unique_lock<std::mutex> lock(internals.Mutex);
+  while (true)
+  {
+    internals.Condition.wait(
+      lock, [&internals]() { return internals.Busy || internals.TerminateWorker; });
+    if (!internals.Busy)
+    {
+      break;
+    }
+
+    // the simulation thread does not touch these until `Busy` is cleared.
+    const int timestep = internals.TimeStep;
+    const double time = internals.Time;
+    const std::vector<std::string> parameters = std::move(internals.Parameters);
+    lock.unlock();
+    {
+      vtkVLogScopeF(PARAVIEW_LOG_CATALYST_VERBOSITY(),
+        "asynchronous execution for timestep=%d, time=%f", timestep, time);
+      vtkInSituInitializationHelper::RunPipelines(timestep, time, parameters);
+    }
+    lock.lock();
+    internals.InExecutePipelines = false;
+    internals.Busy = false;
+    internals.Condition.notify_all();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkInSituInitializationHelper::SetAsynchronousExecution(bool value)
+{
+  if (vtkInSituInitializationHelper::WasInitializedOnce)
+  {
+    vtkLogF(ERROR, "'SetAsynchronousExecution' must be called before 'Initialize'.");
+    return;
+  }
+  vtkInSituInitializationHelper::AsynchronousExecution = value;
+}
+
+//----------------------------------------------------------------------------
+bool vtkInSituInitializationHelper::GetAsynchronousExecution()
+{
+  return vtkInSituInitializationHelper::AsynchronousExecution;
+}
+
+//----------------------------------------------------------------------------
+void vtkInSituInitializationHelper::SetMaximumNumberOfSkippedTimeSteps(int value)
+{
+  vtkInSituInitializationHelper::MaximumNumberOfSkippedTimeSteps = value;
+}
+
+//----------------------------------------------------------------------------
+int vtkInSituInitializationHelper::GetMaximumNumberOfSkippedTimeSteps()
+{
+  return vtkInSituInitializationHelper::MaximumNumberOfSkippedTimeSteps;
+}
+
+//----------------------------------------------------------------------------
+bool vtkInSituInitializationHelper::ShouldSkipTimeStep(int timestep)
+{
+  if (vtkInSituInitializationHelper::Internals == nullptr ||
+    !vtkInSituInitializationHelper::AsynchronousExecution)
+  {
+    return false;
+  }
+
+  auto& internals = (*vtkInSituInitializationHelper::Internals);
+  bool skip = false;
+  {
+    std::lock_guard<std::mutex> lock(internals.Mutex);
+    const int maxSkipped = vtkInSituInitializationHelper::MaximumNumberOfSkippedTimeSteps;
+    skip = internals.Busy && (maxSkipped < 0 || internals.SkippedTimeSteps < maxSkipped);
+  }
+
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+  // Workers finish at different times on different ranks. The analysis is
+  // collective, so the timestep is only skipped if every rank would skip it;
+  // otherwise the ranks that hand it off to their worker would wait forever
+  // for the ones that did not.
+  if (internals.DecisionComm != MPI_COMM_NULL)
+  {
+    int localSkip = skip ? 1 : 0;
+    int globalSkip = 0;
+    MPI_Allreduce(&localSkip, &globalSkip, 1, MPI_INT, MPI_MIN, internals.DecisionComm);
+    skip = (globalSkip == 1);
+  }
+#endif
+
+  if (!skip)
+  {
+    return false;
+  }
 
-  internals.InExecutePipelines = false;
+  std::lock_guard<std::mutex> lock(internals.Mutex);
+  ++internals.SkippedTimeSteps;
+  vtkVLogF(PARAVIEW_LOG_CATALYST_VERBOSITY(),
+    "analysis for timestep=%d still in progress; skipping timestep=%d (%d consecutive)",
+    internals.TimeStep, timestep, internals.SkippedTimeSteps);
   return true;
 }
 
+//----------------------------------------------------------------------------
+void vtkInSituInitializationHelper::WaitForPipelines()
+{
+  if (vtkInSituInitializationHelper::Internals == nullptr ||
+    !vtkInSituInitializationHelper::AsynchronousExecution)
+  {
+    return;
+  }
+
+  auto& internals = (*vtkInSituInitializationHelper::Internals);
+  if (std::this_thread::get_id() == internals.Worker.get_id())
+  {
+    // called from within a pipeline; nothing to wait for.
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(internals.Mutex);
+  if (internals.Busy)
+  {
+    vtkVLogScopeF(PARAVIEW_LOG_CATALYST_VERBOSITY(), "waiting for analysis of timestep=%d",
+      internals.TimeStep);
+    internals.Condition.wait(lock, [&internals]() { return !internals.Busy; });
+  }
+}
+
 //----------------------------------------------------------------------------
 int vtkInSituInitializationHelper::GetAttributeTypeFromString(const std::string& associationString)
 {
@@ -568,6 +801,7 @@ void vtkInSituInitializationHelper::UpdateAllProducers(double time)
   }
 
   vtkVLogScopeF(PARAVIEW_LOG_CATALYST_VERBOSITY(), "Updating all producer (time=%f)", time);
+  vtkInSituInitializationHelper::WaitForPipelines();
 
   auto& internals = (*vtkInSituInitializationHelper::Internals);
   for (const auto& pair : internals.Producers)
@@ -629,6 +863,10 @@ bool vtkInSituInitializationHelper::IsPythonSupported()
 void vtkInSituInitializationHelper::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "AsynchronousExecution: " << vtkInSituInitializationHelper::AsynchronousExecution
+     << endl;
+  os << indent << "MaximumNumberOfSkippedTimeSteps: "
+     << vtkInSituInitializationHelper::MaximumNumberOfSkippedTimeSteps << endl;
 }
 
 //----------------------------------------------------------------------------
@@ -26,6 +26,30 @@
  * codes includes custom Catalyst API implementations or other in situ
  * frameworks.
  *
+ * @section AsynchronousExecution Asynchronous execution
+ *
+ * By default, `ExecutePipelines` executes all analysis pipelines before
+ * returning control to the simulation. When `SetAsynchronousExecution(true)`
+ * is called before `Initialize`, `ExecutePipelines` instead hands the pipelines
+ * off to a dedicated worker thread and returns immediately. The next
+ * modification of any producer (`SetProducer`, `MarkProducerModified`,
+ * `UpdateAllProducers`) or the next `ExecutePipelines` call blocks until the
+ * in-flight analysis has completed, providing back-pressure. Callers can use
+ * `ShouldSkipTimeStep` to skip timesteps instead of blocking when the analysis
+ * falls behind; `SetMaximumNumberOfSkippedTimeSteps` bounds how many
+ * consecutive timesteps may be skipped. `Finalize` drains any pending analysis.
+ *
+ * In asynchronous mode, the caller must ensure that the data referenced by the
+ * producers remains valid until the analysis completes i.e. until
+ * `WaitForPipelines` returns. ParaView-Catalyst does this by copying the
+ * channel data into a double buffer. Asynchronous execution requires MPI
+ * to be initialized with `MPI_THREAD_MULTIPLE` support in MPI-enabled builds;
+ * ParaView uses a duplicate of the communicator passed to `Initialize` in this
+ * mode so that analysis communication never matches simulation messages. When
+ * the requested thread support is not available, pipelines are executed
+ * synchronously. Python analysis pipelines require VTK to be built with
+ * `VTK_PYTHON_FULL_THREADSAFE` enabled.
+ *
  * @sa vtkInitializationHelper
  *
  * @defgroup Insitu ParaView In Situ
@@ -123,11 +147,52 @@ public:
   ///@}
 
   /**
-   * Executes pipelines.
+   * Executes pipelines. In asynchronous mode, this waits for the previous
+   * analysis to complete, if needed, and then returns as soon as the pipelines
+   * have been handed off to the worker thread.
    */
   static bool ExecutePipelines(
     int timestep, double time, const std::vector<std::string>& parameters = {});
 
+  ///@{
+  /**
+   * Enable/disable asynchronous execution of the analysis pipelines. This must
+   * be set before `Initialize` is called and cannot be changed afterwards.
+   * Default is false.
+   */
+  static void SetAsynchronousExecution(bool value);
+  static bool GetAsynchronousExecution();
+  ///@}
+
+  ///@{
+  /**
+   * Maximum number of consecutive timesteps `ShouldSkipTimeStep` may skip
+   * while the analysis of an earlier timestep is still in progress. 0 (the
+   * default) never skips timesteps i.e. the simulation always waits for the
+   * analysis to catch up. A negative value lets the analysis skip as many
+   * timesteps as needed.
+   */
+  static void SetMaximumNumberOfSkippedTimeSteps(int value);
+  static int GetMaximumNumberOfSkippedTimeSteps();
+  ///@}
+
+  /**
+   * In asynchronous mode, returns true if the analysis of an earlier timestep
+   * is still in progress and the current timestep should be skipped, without
+   * modifying any producers. Always returns false in synchronous mode.
+   *
+   * In MPI-enabled builds this is a collective operation: it must be called
+   * on all ranks and a timestep is skipped only if the analysis is still in
+   * progress on every rank, so that all ranks make the same decision.
+   */
+  static bool ShouldSkipTimeStep(int timestep);
+
+  /**
+   * Blocks until pipelines executing asynchronously have completed. Does
+   * nothing in synchronous mode.
+   */
+  static void WaitForPipelines();
+
   ///@{
   /**
    * Provides access to current time and timestep during `ExecutePipelines`
@@ -162,9 +227,13 @@ private:
 
   static void UpdateSteerableProxies();
   static int GetAttributeTypeFromString(const std::string& associationString);
+  static void RunPipelines(int timestep, double time, const std::vector<std::string>& parameters);
+  static void AsynchronousWorker();
 
   static int WasInitializedOnce;
   static int WasFinalizedOnce;
+  static bool AsynchronousExecution;
+  static int MaximumNumberOfSkippedTimeSteps;
 
   class vtkInternals;
   static vtkInternals* Internals;
@@ -708,6 +708,13 @@ void vtkCPPythonScriptV2Helper::DoLive(int timestep, double time)
     }
     internals.LiveLink->SetHostname(hostname.empty() ? "localhost" : hostname.c_str());
     internals.LiveLink->SetInsituPort(port <= 0 ? 22222 : port);
+    if (this->Options->GetProperty("CatalystLiveCompression"))
+    {
+      internals.LiveLink->SetCompressorType(
+        vtkSMPropertyHelper(this->Options, "CatalystLiveCompression").GetAsInt());
+      internals.LiveLink->SetMinimumDeliveryInterval(
+        vtkSMPropertyHelper(this->Options, "CatalystLiveMinimumDeliveryInterval").GetAsDouble());
+    }
   }
 
   auto pxm = this->Options->GetSessionProxyManager();
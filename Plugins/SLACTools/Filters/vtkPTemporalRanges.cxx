@@ -133,11 +133,16 @@ void vtkPTemporalRanges::Reduce(vtkTable* table)
 
   VTK_CREATE(vtkReductionFilter, reduceFilter);
   reduceFilter->SetController(this->Controller);
+  reduceFilter->SetTreeReductionFanIn(vtkReductionFilter::DEFAULT_TREE_REDUCTION_FAN_IN);
 
   VTK_CREATE(vtkPTemporalRanges::vtkRangeTableReduction, reduceOperation);
   reduceOperation->SetParent(this);
   reduceFilter->SetPostGatherHelper(reduceOperation);
 
+  // Accumulating range tables weighs averages by their counts, which makes the
+  // reduction associative and lets it run along a tree of processes.
+  vtkReductionFilter::RegisterAssociativePostGatherHelper(reduceOperation->GetClassName());
+
   VTK_CREATE(vtkTable, copy);
   copy->ShallowCopy(table);
   reduceFilter->SetInputData(copy);
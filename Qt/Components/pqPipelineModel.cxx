@@ -59,10 +59,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <QApplication>
 #include <QFont>
+#include <QHash>
 #include <QString>
 #include <QStyle>
 #include <QtDebug>
 
+#include <algorithm>
 #include <cassert>
 
 class ModifiedLiveInsituLink : public vtkCommand
@@ -152,12 +154,14 @@ public:
     }
     if (this->Object)
     {
+      this->registerItem();
       this->updateVisibilityIcon(this->Model->view(), false);
     }
     this->InConstructor = false;
   }
   ~pqPipelineModelDataItem() override
   {
+    this->unregisterItem();
     if (this->Type == pqPipelineModel::Link && this->Model->Internal)
     {
       pqPipelineModelDataItem* proxyItem =
@@ -174,6 +178,7 @@ public:
     this->Object = other.Object;
     this->Type = other.Type;
     this->VisibilityIcon = other.VisibilityIcon;
+    this->registerItem();
     Q_FOREACH (pqPipelineModelDataItem* otherChild, other.Children)
     {
       pqPipelineModelDataItem* child =
@@ -210,6 +215,45 @@ public:
     return this->Parent->Children.indexOf(this);
   }
 
+  // Adds/removes this item from the model's index of items by
+  // pqServerManagerModelItem. Link items are not indexed, they are reached
+  // through the Links of the Proxy item instead.
+  void registerItem();
+  void unregisterItem();
+
+  // returns true if this item is `ancestor` or one of its descendants.
+  bool isInSubtree(const pqPipelineModelDataItem* ancestor) const
+  {
+    for (const pqPipelineModelDataItem* item = this; item; item = item->Parent)
+    {
+      if (item == ancestor)
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // returns true if this item is visited before `other` in a depth-first,
+  // pre-order traversal of the tree.
+  bool precedes(pqPipelineModelDataItem* other)
+  {
+    QList<int> path = this->getPathFromRoot();
+    QList<int> otherPath = other->getPathFromRoot();
+    return std::lexicographical_compare(
+      path.begin(), path.end(), otherPath.begin(), otherPath.end());
+  }
+
+  QList<int> getPathFromRoot()
+  {
+    QList<int> path;
+    for (pqPipelineModelDataItem* item = this; item->Parent; item = item->Parent)
+    {
+      path.push_front(item->getIndexInParent());
+    }
+    return path;
+  }
+
   QString getIconType() const
   {
     switch (this->Type)
@@ -466,10 +510,36 @@ public:
 
   QFont ModifiedFont;
   pqPipelineModelDataItem Root;
+  // All data items except Link items, by the object they represent. Used by
+  // pqPipelineModel::getDataItem() to avoid searching the whole tree.
+  QHash<pqServerManagerModelItem*, pqPipelineModelDataItem*> DataItems;
   pqTimer DelayedUpdateVisibilityTimer;
   QList<QPointer<pqPipelineSource>> DelayedUpdateVisibilityItems;
 };
 
+//-----------------------------------------------------------------------------
+void pqPipelineModelDataItem::registerItem()
+{
+  if (this->Object && this->Type != pqPipelineModel::Link &&
+    this->Type != pqPipelineModel::Invalid && this->Model->Internal)
+  {
+    this->Model->Internal->DataItems[this->Object] = this;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void pqPipelineModelDataItem::unregisterItem()
+{
+  if (this->Object && this->Model->Internal)
+  {
+    auto iter = this->Model->Internal->DataItems.find(this->Object);
+    if (iter != this->Model->Internal->DataItems.end() && iter.value() == this)
+    {
+      this->Model->Internal->DataItems.erase(iter);
+    }
+  }
+}
+
 //-----------------------------------------------------------------------------
 void pqPipelineModel::constructor()
 {
@@ -975,20 +1045,33 @@ pqPipelineModelDataItem* pqPipelineModel::getDataItem(
     return nullptr;
   }
 
-  if (_parent->Object == item && (type == pqPipelineModel::Invalid || type == _parent->Type))
+  auto iter = this->Internal->DataItems.constFind(item);
+  if (iter == this->Internal->DataItems.constEnd())
   {
-    return _parent;
+    return nullptr;
   }
 
-  Q_FOREACH (pqPipelineModelDataItem* child, _parent->Children)
+  // Only items in the subtree of _parent are considered. When several match
+  // (i.e. a Proxy item and its Link items), the first one in depth-first
+  // order is returned.
+  pqPipelineModelDataItem* dataItem = iter.value();
+  pqPipelineModelDataItem* retVal = nullptr;
+  if ((type == pqPipelineModel::Invalid || type == dataItem->Type) &&
+    dataItem->isInSubtree(_parent))
   {
-    pqPipelineModelDataItem* retVal = this->getDataItem(item, child, type);
-    if (retVal && (type == pqPipelineModel::Invalid || type == retVal->Type))
+    retVal = dataItem;
+  }
+  if (type == pqPipelineModel::Invalid || type == pqPipelineModel::Link)
+  {
+    Q_FOREACH (pqPipelineModelDataItem* link, dataItem->Links)
     {
-      return retVal;
+      if (link->isInSubtree(_parent) && (!retVal || link->precedes(retVal)))
+      {
+        retVal = link;
+      }
     }
   }
-  return nullptr;
+  return retVal;
 }
 
 //-----------------------------------------------------------------------------
@@ -1548,10 +1631,7 @@ void pqPipelineModel::updateData(pqServerManagerModelItem* source, ItemType type
   }
   else // source is null, so update everything
   {
-    Q_FOREACH (pqPipelineModelDataItem* child, this->Internal->Root.Children)
-    {
-      this->itemDataChanged(child);
-    }
+    this->serverDataChanged();
   }
 }
 
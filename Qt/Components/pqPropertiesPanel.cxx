@@ -170,6 +170,11 @@ public:
   QPointer<pqDataRepresentation> Representation;
   QMap<void*, QPointer<pqProxyWidgets>> SourceWidgets;
   QPointer<pqProxyWidgets> DisplayWidgets;
+  // Display panels for the representations shown most recently, the most
+  // recent last. Creating a display panel is slow for representations with
+  // many properties, so they are kept around when the active representation
+  // changes.
+  QList<QPointer<pqProxyWidgets>> RecentDisplayWidgets;
   QPointer<pqProxyWidgets> ViewWidgets;
   bool ReceivedChangeAvailable;
   vtkNew<vtkSMProxyClipboard> SourceClipboard;
@@ -236,9 +241,50 @@ public:
     }
     this->SourceWidgets.clear();
     delete this->DisplayWidgets;
+    Q_FOREACH (pqProxyWidgets* widgets, this->RecentDisplayWidgets)
+    {
+      delete widgets;
+    }
+    this->RecentDisplayWidgets.clear();
     delete this->ViewWidgets;
   }
 
+  //---------------------------------------------------------------------------
+  /// Keeps a display panel that is no longer shown for reuse, deleting the
+  /// least recently used ones when there are too many.
+  void releaseDisplayWidgets(pqProxyWidgets* widgets)
+  {
+    const int maxRecentDisplayWidgets = 10;
+    if (widgets->Proxy.isNull())
+    {
+      delete widgets;
+      return;
+    }
+    // panels of deleted representations are deleted with them.
+    this->RecentDisplayWidgets.removeAll(QPointer<pqProxyWidgets>());
+    this->RecentDisplayWidgets.push_back(widgets);
+    while (this->RecentDisplayWidgets.size() > maxRecentDisplayWidgets)
+    {
+      delete this->RecentDisplayWidgets.takeFirst();
+    }
+  }
+
+  //---------------------------------------------------------------------------
+  /// Returns the display panel kept for the representation, if any.
+  pqProxyWidgets* takeDisplayWidgets(pqDataRepresentation* repr)
+  {
+    for (int cc = 0; cc < this->RecentDisplayWidgets.size(); ++cc)
+    {
+      pqProxyWidgets* widgets = this->RecentDisplayWidgets[cc];
+      if (widgets && widgets->Proxy == repr)
+      {
+        this->RecentDisplayWidgets.removeAt(cc);
+        return widgets;
+      }
+    }
+    return nullptr;
+  }
+
   //---------------------------------------------------------------------------
   void updateInformationAndDomains()
   {
@@ -562,21 +608,29 @@ void pqPropertiesPanel::updateDisplayPanel(pqDataRepresentation* repr)
   // do the block of code if (repr==nullptr) event if nothing has changed.
   if (this->Internals->Representation != repr || repr == nullptr)
   {
-    // Representation has changed, destroy the current display panel and create
-    // a new one. Unlike properties panels, display panels are not cached.
+    // Representation has changed, hide the current display panel and show the
+    // one for the new representation. Unlike properties panels, only the
+    // display panels for the few most recent representations are kept.
     if (this->Internals->DisplayWidgets)
     {
       this->Internals->DisplayWidgets->hide();
-      delete this->Internals->DisplayWidgets;
+      this->Internals->releaseDisplayWidgets(this->Internals->DisplayWidgets);
+      this->Internals->DisplayWidgets = nullptr;
     }
     this->Internals->RepresentationEventConnect->Disconnect();
     this->Internals->Representation = repr;
     if (repr)
     {
-      // create the panel for the repr.
-      pqProxyWidgets* widgets = new pqProxyWidgets(repr, this);
-      widgets->Panel->setApplyChangesImmediately(true);
-      QObject::connect(widgets->Panel, SIGNAL(changeFinished()), this, SLOT(renderActiveView()));
+      pqProxyWidgets* widgets = this->Internals->takeDisplayWidgets(repr);
+      if (!widgets)
+      {
+        // create the panel for the repr.
+        widgets = new pqProxyWidgets(repr, this);
+        widgets->Panel->setApplyChangesImmediately(true);
+        QObject::connect(
+          widgets->Panel, SIGNAL(changeFinished()), this, SLOT(renderActiveView()));
+        QObject::connect(repr, SIGNAL(destroyed()), widgets, SLOT(deleteLater()));
+      }
       this->Internals->DisplayWidgets = widgets;
       this->Internals->DisplayWidgets->show(this->Internals->Ui.DisplayFrame);
 
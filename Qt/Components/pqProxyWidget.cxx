@@ -425,7 +425,12 @@ public:
         QString(":disabled { color: %1; background-color: %2 }")
           .arg(palette.color(QPalette::Active, QPalette::WindowText).name(QColor::HexArgb))
           .arg(palette.color(QPalette::Active, QPalette::Base).name(QColor::HexArgb));
-      this->PropertyWidget->setStyleSheet(styleSheet);
+      // setting a style sheet re-polishes the whole widget subtree, so avoid
+      // doing it each time the panel is filtered.
+      if (this->PropertyWidget->styleSheet() != styleSheet)
+      {
+        this->PropertyWidget->setStyleSheet(styleSheet);
+      }
     }
     this->PropertyWidget->show();
 
@@ -32,8 +32,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "pqTransferFunctionWidget.h"
 
 #include "QVTKOpenGLNativeWidget.h"
+#include "pqApplicationCore.h"
 #include "pqCoreUtilities.h"
 #include "pqTimer.h"
+#include "pqUndoStack.h"
 #include "vtkAxis.h"
 #include "vtkBoundingBox.h"
 #include "vtkChartXY.h"
@@ -207,6 +209,9 @@ public:
   vtkSmartPointer<vtkControlPointsItem> ControlPointsItem;
   unsigned long CurrentPointEditEventId;
 
+  // Undo stack coalescing the changes made while control points are dragged.
+  QPointer<pqUndoStack> CoalescingUndoStack;
+
   vtkWeakPointer<vtkScalarsToColors> ScalarsToColors;
   vtkWeakPointer<vtkPiecewiseFunction> PiecewiseFunction;
 
@@ -259,8 +264,18 @@ public:
   }
   ~pqInternals() { this->cleanup(); }
 
+  void endUndoCoalescing()
+  {
+    if (this->CoalescingUndoStack)
+    {
+      this->CoalescingUndoStack->endCoalescing();
+    }
+    this->CoalescingUndoStack = nullptr;
+  }
+
   void cleanup()
   {
+    this->endUndoCoalescing();
     this->RangeTimer.disconnect();
     this->VTKConnect->Disconnect();
     this->ChartXY->ClearPlots();
@@ -438,6 +453,10 @@ void pqTransferFunctionWidget::initialize(
       vtkControlPointsItem::CurrentPointChangedEvent, this, SLOT(onCurrentChangedEvent()));
     pqCoreUtilities::connect(this->Internals->ControlPointsItem, vtkCommand::EndEvent, this,
       SIGNAL(controlPointsModified()));
+    pqCoreUtilities::connect(this->Internals->ControlPointsItem,
+      vtkCommand::StartInteractionEvent, this, SLOT(onStartInteraction()));
+    pqCoreUtilities::connect(this->Internals->ControlPointsItem, vtkCommand::EndInteractionEvent,
+      this, SLOT(onEndInteraction()));
   }
 
   // If the transfer functions change, we need to re-render the view. This ensures that.
@@ -479,6 +498,25 @@ void pqTransferFunctionWidget::initialize(
     SLOT(showUsageStatus()));
 }
 
+//-----------------------------------------------------------------------------
+void pqTransferFunctionWidget::onStartInteraction()
+{
+  // Changes made while dragging control points are undone in a single step.
+  auto& internals = (*this->Internals);
+  internals.endUndoCoalescing();
+  internals.CoalescingUndoStack = pqApplicationCore::instance()->getUndoStack();
+  if (internals.CoalescingUndoStack)
+  {
+    internals.CoalescingUndoStack->beginCoalescing();
+  }
+}
+
+//-----------------------------------------------------------------------------
+void pqTransferFunctionWidget::onEndInteraction()
+{
+  this->Internals->endUndoCoalescing();
+}
+
 //-----------------------------------------------------------------------------
 void pqTransferFunctionWidget::onCurrentPointEditEvent()
 {
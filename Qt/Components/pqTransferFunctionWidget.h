@@ -174,6 +174,14 @@ protected Q_SLOTS:
    */
   void editColorAtCurrentControlPoint();
 
+  /**
+   * slots called when the internal vtkControlPointsItem starts and ends an
+   * interaction, e.g. a control point drag. The undo sets pushed in between
+   * are coalesced (see vtkSMUndoStack::BeginCoalescing).
+   */
+  void onStartInteraction();
+  void onEndInteraction();
+
 protected: // NOLINT(readability-redundant-access-specifiers)
   /**
    * callback called when vtkControlPointsItem fires
@@ -70,6 +70,11 @@ void pqProgressManager::onServerAdded(pqServer* server)
   pqCoreUtilities::connect(progressHandler, vtkCommand::EndEvent, this, SLOT(onEndProgress()));
   pqCoreUtilities::connect(
     progressHandler, vtkCommand::ProgressEvent, this, SLOT(onProgress(vtkObject*)));
+
+  if (!server->isRemote())
+  {
+    this->BuiltinServer = server;
+  }
 }
 
 //-----------------------------------------------------------------------------
@@ -197,6 +202,15 @@ void pqProgressManager::setEnableProgress(bool enable)
 void pqProgressManager::triggerAbort()
 {
   Q_EMIT this->abort();
+
+  if (this->BuiltinServer)
+  {
+    vtkPVProgressHandler* handler = this->BuiltinServer->session()->GetProgressHandler();
+    if (handler->GetEnableProgress())
+    {
+      handler->RequestAbort();
+    }
+  }
 }
 
 //-----------------------------------------------------------------------------
@@ -114,6 +114,11 @@ public Q_SLOTS:
 
   /**
    * fires abort(). Must be called by the GUI that triggers abort.
+   * For builtin sessions, this also requests the progress handler to abort
+   * the pipeline execution in progress (see vtkPVProgressHandler::RequestAbort).
+   * Since no Qt events are processed during a builtin update, this is only
+   * effective when called from code that runs during the update, e.g. a slot
+   * connected to progress().
    */
   void triggerAbort();
 
@@ -167,6 +172,9 @@ protected: // NOLINT(readability-redundant-access-specifiers)
   bool ReadyEnableProgress;
   bool UnblockEvents;
 
+  // Builtin server, if any, for which pipeline execution can be aborted.
+  QPointer<pqServer> BuiltinServer;
+
 private:
   Q_DISABLE_COPY(pqProgressManager)
 };
@@ -251,6 +251,18 @@ void pqUndoStack::clear()
   this->Implementation->IgnoreAllChangesStack.clear();
 }
 
+//-----------------------------------------------------------------------------
+void pqUndoStack::beginCoalescing()
+{
+  this->Implementation->UndoStack->BeginCoalescing();
+}
+
+//-----------------------------------------------------------------------------
+void pqUndoStack::endCoalescing()
+{
+  this->Implementation->UndoStack->EndCoalescing();
+}
+
 //-----------------------------------------------------------------------------
 void pqUndoStack::beginNonUndoableChanges()
 {
@@ -146,6 +146,14 @@ public Q_SLOTS: // NOLINT(readability-redundant-access-specifiers)
   void beginNonUndoableChanges();
   void endNonUndoableChanges();
 
+  /**
+   * Begin/end a scope in which successive undo sets with the same label, that
+   * each change the same proxy, are coalesced into a single undo set, e.g. for
+   * the duration of a mouse drag. See vtkSMUndoStack::BeginCoalescing().
+   */
+  void beginCoalescing();
+  void endCoalescing();
+
   /**
    * One can add arbitrary elements to the undo set currently being built.
    */
@@ -24,6 +24,7 @@
 #include "vtkPVVersion.h"
 #include "vtkProcessModule.h"
 #include "vtkResourceFileLocator.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkVersion.h"
 
@@ -50,6 +51,7 @@
 #include <ctime>
 #include <set>
 #include <string>
+#include <vector>
 #include <vtksys/Encoding.hxx>
 #include <vtksys/RegularExpression.hxx>
 #include <vtksys/SystemTools.hxx>
@@ -895,7 +897,10 @@ void vtkPVFileInformation::FetchUnixDirectoryListing()
     return;
   }
 
-  // Loop through the directory listing.
+  // Loop through the directory listing. Stat-ing the entries is done
+  // afterwards, concurrently, since it dominates the listing time on
+  // network and parallel filesystems.
+  std::vector<vtkSmartPointer<vtkPVFileInformation>> infos;
   while (const dirent* d = readdir(dir))
   {
     // Skip the special directory entries.
@@ -903,57 +908,69 @@ void vtkPVFileInformation::FetchUnixDirectoryListing()
     {
       continue;
     }
-    vtkPVFileInformation* info = vtkPVFileInformation::New();
+    vtkNew<vtkPVFileInformation> info;
     info->SetName(d->d_name);
     info->SetFullPath((prefix + d->d_name).c_str());
     info->Type = INVALID;
     info->SetHiddenFlag();
-
-    vtksys::SystemTools::Stat_t status;
-    int res;
-    if (this->ReadDetailedFileInformation)
-    {
-      // Recover status info
-      res = vtksys::SystemTools::Stat(info->FullPath, &status);
-      if (res != -1)
-      {
-        if (!S_ISDIR(status.st_mode))
-        {
-          std::string::size_type pos = std::string(d->d_name).rfind('.');
-          if (pos != std::string::npos)
-          {
-            std::string ext = std::string(d->d_name).substr(pos + 1);
-            info->SetExtension(ext.c_str());
-          }
-        }
-        info->Size = status.st_size;
-        info->ModificationTime = status.st_mtime;
-      }
-    }
-// fix to bug #09452 such that directories with trailing names can be
-// shown in the file dialog
-#if defined(__SVR4) && defined(__sun)
-    if (!this->ReadDetailedFileInformation)
-    {
-      res = vtksys::SystemTools::Stat(info->FullPath, &status);
-    }
-    if (res != -1 && status.st_mode & S_IFDIR)
+#if !(defined(__SVR4) && defined(__sun))
+    if (d->d_type & DT_DIR)
     {
       info->Type = DIRECTORY;
     }
-#else
-    if (d->d_type & DT_DIR)
+    else if (d->d_type == DT_REG)
     {
-      info->Type = DIRECTORY;
+      // a regular file, no need for DetectType() to stat it again.
+      info->Type = SINGLE_FILE;
     }
 #endif
-
     info->FastFileTypeDetection = this->FastFileTypeDetection;
-    info_set.insert(info);
-    info->Delete();
+    infos.emplace_back(info);
   }
   closedir(dir);
 
+// fix to bug #09452 such that directories with trailing names can be
+// shown in the file dialog
+#if defined(__SVR4) && defined(__sun)
+  const bool needsStat = true;
+#else
+  const bool needsStat = this->ReadDetailedFileInformation;
+#endif
+  if (needsStat)
+  {
+    const bool readDetails = this->ReadDetailedFileInformation;
+    vtkSMPTools::For(0, static_cast<vtkIdType>(infos.size()), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType cc = begin; cc < end; ++cc)
+      {
+        vtkPVFileInformation* info = infos[cc];
+        vtksys::SystemTools::Stat_t status;
+        int res = vtksys::SystemTools::Stat(info->FullPath, &status);
+        if (res != -1 && readDetails)
+        {
+          // Recover status info
+          if (!S_ISDIR(status.st_mode))
+          {
+            std::string::size_type pos = std::string(info->Name).rfind('.');
+            if (pos != std::string::npos)
+            {
+              std::string ext = std::string(info->Name).substr(pos + 1);
+              info->SetExtension(ext.c_str());
+            }
+          }
+          info->Size = status.st_size;
+          info->ModificationTime = status.st_mtime;
+        }
+#if defined(__SVR4) && defined(__sun)
+        if (res != -1 && status.st_mode & S_IFDIR)
+        {
+          info->Type = DIRECTORY;
+        }
+#endif
+      }
+    });
+  }
+  info_set.insert(infos.begin(), infos.end());
+
   this->OrganizeCollection(info_set);
 
   // Now we detect the file types for items.
@@ -16,6 +16,7 @@
 
 #include "vtkClientServerStream.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVCompositeDataPipeline.h"
 #include "vtkProcessModule.h"
 
 #include <vtksys/SystemInformation.hxx>
@@ -53,6 +54,7 @@ void vtkPVMemoryUseInformation::CopyFromObject(vtkObject* obj)
   info.Rank = vtkProcessModule::GetProcessModule()->GetPartitionId();
   info.ProcMemUse = sysInfo.GetProcMemoryUsed();
   info.HostMemUse = sysInfo.GetHostMemoryUsed();
+  info.TemporalCacheMemUse = vtkPVCompositeDataPipeline::GetTemporalCacheMemoryUse();
 
 #ifdef vtkPVMemoryUseInformationDEBUG
   info.Print();
@@ -86,7 +88,7 @@ void vtkPVMemoryUseInformation::CopyToStream(vtkClientServerStream* css)
   for (size_t i = 0; i < count; ++i)
   {
     *css << this->MemInfos[i].ProcessType << this->MemInfos[i].Rank << this->MemInfos[i].ProcMemUse
-         << this->MemInfos[i].HostMemUse;
+         << this->MemInfos[i].HostMemUse << this->MemInfos[i].TemporalCacheMemUse;
   }
 
   *css << vtkClientServerStream::End;
@@ -116,6 +118,10 @@ void vtkPVMemoryUseInformation::CopyFromStream(const vtkClientServerStream* css)
 
     vtkVerifyParseMacro(css->GetArgument(0, offset, &MemInfos[i].HostMemUse), "HostMemUse");
     ++offset;
+
+    vtkVerifyParseMacro(
+      css->GetArgument(0, offset, &MemInfos[i].TemporalCacheMemUse), "TemporalCacheMemUse");
+    ++offset;
   }
 }
 
@@ -131,5 +137,6 @@ void vtkPVMemoryUseInformation::MemInfo::Print()
   cerr << "ProcessType=" << this->ProcessType << endl
        << "Rank=" << this->Rank << endl
        << "ProcMemUse=" << this->ProcMemUse << endl
-       << "HostMemUse=" << this->HostMemUse << endl;
+       << "HostMemUse=" << this->HostMemUse << endl
+       << "TemporalCacheMemUse=" << this->TemporalCacheMemUse << endl;
 }
@@ -62,6 +62,7 @@ public:
   int GetRank(size_t i) { return this->MemInfos[i].Rank; }
   long long GetProcMemoryUse(size_t i) { return this->MemInfos[i].ProcMemUse; }
   long long GetHostMemoryUse(size_t i) { return this->MemInfos[i].HostMemUse; }
+  long long GetTemporalCacheMemoryUse(size_t i) { return this->MemInfos[i].TemporalCacheMemUse; }
 
 protected:
   vtkPVMemoryUseInformation();
@@ -76,6 +77,7 @@ private:
       , Rank(0)
       , ProcMemUse(0)
       , HostMemUse(0)
+      , TemporalCacheMemUse(0)
     {
     }
     void Print();
@@ -84,6 +86,7 @@ private:
     int Rank;
     long long ProcMemUse;
     long long HostMemUse;
+    long long TemporalCacheMemUse;
   };
   vector<MemInfo> MemInfos;
 
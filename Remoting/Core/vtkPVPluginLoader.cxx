@@ -18,6 +18,7 @@
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPDirectory.h"
+#include "vtkPSystemTools.h"
 #include "vtkPVLogger.h"
 #include "vtkPVPlugin.h"
 #include "vtkPVPluginTracker.h"
@@ -69,32 +70,23 @@ class vtkPVXMLOnlyPlugin
 public:
   static vtkPVXMLOnlyPlugin* Create(const char* xmlfile)
   {
+    // read the file once and validate the XML from memory.
+    vtksys::ifstream is(xmlfile, ios::binary);
+    if (!is)
+    {
+      return nullptr;
+    }
+    std::string xml{ std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>() };
+
     vtkNew<vtkPVXMLParser> parser;
-    parser->SetFileName(xmlfile);
-    if (!parser->Parse())
+    if (!parser->Parse(xml.c_str()))
     {
       return nullptr;
     }
 
     vtkPVXMLOnlyPlugin* instance = new vtkPVXMLOnlyPlugin();
     instance->PluginName = vtksys::SystemTools::GetFilenameWithoutExtension(xmlfile);
-
-    vtksys::ifstream is;
-    is.open(xmlfile, ios::binary);
-    // get length of file:
-    is.seekg(0, ios::end);
-    size_t length = is.tellg();
-    is.seekg(0, ios::beg);
-
-    // allocate memory:
-    char* buffer = new char[length + 1];
-
-    // read data as a block:
-    is.read(buffer, length);
-    is.close();
-    buffer[length] = 0;
-    instance->XML = buffer;
-    delete[] buffer;
+    instance->XML = std::move(xml);
     return instance;
   }
 
@@ -395,8 +387,9 @@ void vtkPVPluginLoader::LoadPluginsFromPath(const char* path)
     full_file += '/';
     full_file += rel_path;
 
-    // Check if it exists and is a file.
-    if (!assume_exists && !vtksys::SystemTools::FileExists(full_file, true))
+    // Check if it exists and is a file. The directory listing comes from the
+    // root rank, so check on the root rank too.
+    if (!assume_exists && !vtkPSystemTools::FileExists(full_file, true))
     {
       continue;
     }
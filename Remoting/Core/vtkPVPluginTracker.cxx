@@ -16,6 +16,8 @@
 
 #include "vtkClientServerInterpreterInitializer.h"
 #include "vtkCommand.h"
+#include "vtkMultiProcessController.h"
+#include "vtkMultiProcessStream.h"
 #include "vtkObjectFactory.h"
 #include "vtkPResourceFileLocator.h"
 #include "vtkPSystemTools.h"
@@ -37,6 +39,7 @@
 #include "vtksys/SystemTools.hxx"
 
 #include <cassert>
+#include <iterator>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -206,6 +209,42 @@ std::string vtkGetPluginNameFromFileName(const std::string& filename)
   }
   return defaultname;
 }
+
+/**
+ * Reads a file on the root rank and broadcasts its contents to the other
+ * ranks, so that starting up on many ranks does not have every rank read the
+ * same configuration files. Must be called on all ranks.
+ */
+bool vtkReadFileOnRootRank(const std::string& filename, std::string& contents)
+{
+  vtkMultiProcessController* controller = vtkMultiProcessController::GetGlobalController();
+  const int myRank = controller ? controller->GetLocalProcessId() : 0;
+
+  int success = 0;
+  if (myRank == 0)
+  {
+    vtksys::ifstream is(filename.c_str(), ios::binary);
+    if (is)
+    {
+      contents.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+      success = 1;
+    }
+  }
+
+  if (controller != nullptr && controller->GetNumberOfProcesses() > 1)
+  {
+    vtkMultiProcessStream stream;
+    if (myRank == 0)
+    {
+      stream << success << contents;
+    }
+    if (controller->Broadcast(stream, 0) && myRank > 0)
+    {
+      stream >> success >> contents;
+    }
+  }
+  return success != 0;
+}
 }
 
 class vtkPVPluginTracker::vtkPluginsList : public std::vector<vtkItem>
@@ -300,7 +339,7 @@ void vtkPVPluginTracker::LoadPluginConfigurationXMLs(const char* appname)
     // Try it as a bundle.
     {
       auto conf = exe_dir + "/../Resources/" + appname + ".conf";
-      if (vtksys::SystemTools::FileExists(conf))
+      if (vtkPSystemTools::FileExists(conf))
       {
         this->LoadPluginConfigurationXMLConf(exe_dir, conf);
         return;
@@ -310,7 +349,7 @@ void vtkPVPluginTracker::LoadPluginConfigurationXMLs(const char* appname)
     // Load it from beside the executable.
     {
       auto conf = exe_dir + "/" + appname + ".conf";
-      if (vtksys::SystemTools::FileExists(conf))
+      if (vtkPSystemTools::FileExists(conf))
       {
         this->LoadPluginConfigurationXMLConf(exe_dir, conf);
         return;
@@ -344,11 +383,18 @@ void vtkPVPluginTracker::LoadPluginConfigurationXMLs(const char* appname)
 void vtkPVPluginTracker::LoadPluginConfigurationXMLConf(
   std::string const& exe_dir, std::string const& conf)
 {
-  vtksys::ifstream fin(conf.c_str());
+  std::string contents;
+  vtkReadFileOnRootRank(conf, contents);
+  std::istringstream fin(contents);
   std::string line;
   // TODO: Replace with a JSON parser.
   while (std::getline(fin, line))
   {
+    // The file is read in binary mode, drop the '\r' of CRLF line endings.
+    if (!line.empty() && line.back() == '\r')
+    {
+      line.pop_back();
+    }
     if (!vtksys::SystemTools::FileIsFullPath(line))
     {
       line = std::string(exe_dir).append("/").append(line);
@@ -368,10 +414,10 @@ void vtkPVPluginTracker::LoadPluginConfigurationXML(const char* filename, bool f
     return;
   }
 
+  std::string contents;
   vtkSmartPointer<vtkPVXMLParser> parser = vtkSmartPointer<vtkPVXMLParser>::New();
-  parser->SetFileName(filename);
   parser->SuppressErrorMessagesOn();
-  if (!parser->Parse())
+  if (!vtkReadFileOnRootRank(filename, contents) || !parser->Parse(contents.c_str()))
   {
     vtkVLogF(PARAVIEW_LOG_PLUGIN_VERBOSITY(),
       "Loading plugin configuration xml `%s` -- failed, invalid XML!", filename);
@@ -27,9 +27,12 @@
 #include "vtkPVSession.h"
 #include "vtkProcessModule.h"
 #include "vtkTimerLog.h"
+#include "vtkWeakPointer.h"
 
+#include <atomic>
 #include <map>
 #include <string>
+#include <vector>
 
 // define this variable to disable progress all together. This may be useful to
 // doing really large runs.
@@ -99,10 +102,19 @@ public:
   // between calls to PrepareProgress() and CleanupPendingProgress().
   bool EnableProgress;
 
+  // Set by RequestAbort(), reset by PrepareProgress() and once an algorithm
+  // has been asked to abort.
+  std::atomic<bool> AbortRequested;
+
+  // Algorithms aborted since PrepareProgress(). They are modified once the
+  // update is done so that the next update executes them again.
+  std::vector<vtkWeakPointer<vtkAlgorithm>> AbortedAlgorithms;
+
   vtkNew<vtkTimerLog> ProgressTimer;
   vtkInternals()
   {
     this->EnableProgress = false;
+    this->AbortRequested = false;
 
 #ifdef PV_DISABLE_PROGRESS_HANDLING
     this->DisableProgressHandling = true;
@@ -228,6 +240,19 @@ void vtkPVProgressHandler::PrepareProgress()
   SKIP_IF_DISABLED();
   this->InvokeEvent(vtkCommand::StartEvent, this);
   this->Internals->EnableProgress = true;
+  this->Internals->AbortRequested = false;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVProgressHandler::RequestAbort()
+{
+  this->Internals->AbortRequested = true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVProgressHandler::GetAbortRequested()
+{
+  return this->Internals->AbortRequested;
 }
 
 //----------------------------------------------------------------------------
@@ -309,6 +334,19 @@ void vtkPVProgressHandler::LocalCleanupPendingProgress()
 {
   SKIP_IF_DISABLED();
   this->Internals->EnableProgress = false;
+
+  // Aborted algorithms have had their outputs marked as generated by the
+  // executive. Modify them now that the update is over, otherwise their partial
+  // outputs would be reused by the next update.
+  for (auto& alg : this->Internals->AbortedAlgorithms)
+  {
+    if (alg)
+    {
+      alg->Modified();
+    }
+  }
+  this->Internals->AbortedAlgorithms.clear();
+
   this->InvokeEvent(vtkCommand::EndEvent, this);
 }
 
@@ -321,6 +359,16 @@ void vtkPVProgressHandler::OnProgressEvent(vtkObject* caller, unsigned long even
     return;
   }
 
+  // Honor abort requests before clamping, so that the algorithm stops as soon
+  // as possible. Only the first algorithm to report progress is aborted, the
+  // algorithms downstream of it execute as usual.
+  vtkAlgorithm* alg = vtkAlgorithm::SafeDownCast(caller);
+  if (alg && this->Internals->AbortRequested.exchange(false))
+  {
+    alg->SetAbortExecute(1);
+    this->Internals->AbortedAlgorithms.emplace_back(alg);
+  }
+
   // Try to clamp frequent progress events.
   this->Internals->ProgressTimer->StopTimer();
   // cout <<"Elapsed: " << this->Internals->ProgressTimer->GetElapsedTime() <<
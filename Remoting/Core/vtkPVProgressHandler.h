@@ -98,6 +98,25 @@ public:
    */
   void LocalCleanupPendingProgress();
 
+  /**
+   * Request that the pipeline execution currently being observed be aborted.
+   * The request is honored at the next progress event fired by an algorithm
+   * in this process: that algorithm's AbortExecute flag is set, which VTK
+   * checks at algorithm boundaries, and the request is cleared. Aborted
+   * algorithms are modified by LocalCleanupPendingProgress() so that the next
+   * update executes them again. The request is also reset by
+   * PrepareProgress(). This may be called from another thread than the one
+   * executing the pipeline. Since requests are not forwarded to remote
+   * processes, this is only effective in builtin sessions.
+   */
+  void RequestAbort();
+
+  /**
+   * Returns true if RequestAbort() was called and no algorithm has been
+   * aborted for it yet.
+   */
+  bool GetAbortRequested();
+
   ///@{
   /**
    * Get/Set the progress interval in seconds. Progress events
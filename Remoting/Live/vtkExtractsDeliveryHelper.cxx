@@ -16,9 +16,13 @@
 
 #include "vtkAlgorithmOutput.h"
 #include "vtkCellData.h"
+#include "vtkCharArray.h"
+#include "vtkCommunicator.h"
 #include "vtkCompositeDataSet.h"
 #include "vtkDataObject.h"
 #include "vtkDataObjectTypes.h"
+#include "vtkLZ4DataCompressor.h"
+#include "vtkLZMADataCompressor.h"
 #include "vtkMultiProcessController.h"
 #include "vtkMultiProcessControllerHelper.h"
 #include "vtkMultiProcessStream.h"
@@ -26,10 +30,55 @@
 #include "vtkPointData.h"
 #include "vtkSocketController.h"
 #include "vtkStructuredGrid.h"
+#include "vtkTimerLog.h"
 #include "vtkTrivialProducer.h"
 #include "vtkUnsignedCharArray.h"
+#include "vtkZLibDataCompressor.h"
 
+#include <algorithm>
 #include <cassert>
+#include <vector>
+
+namespace
+{
+// Indicates what follows the extract key sent to the consumer.
+enum ExtractDeliveryMode
+{
+  // the extract has not changed since it was last delivered.
+  EXTRACT_UNCHANGED = 0,
+  // the extract data follows.
+  EXTRACT_DATA = 1
+};
+
+vtkSmartPointer<vtkDataCompressor> NewCompressor(int type, int level)
+{
+  vtkSmartPointer<vtkDataCompressor> compressor;
+  switch (type)
+  {
+    case vtkExtractsDeliveryHelper::ZLIB:
+      compressor = vtkSmartPointer<vtkZLibDataCompressor>::New();
+      break;
+    case vtkExtractsDeliveryHelper::LZ4:
+      compressor = vtkSmartPointer<vtkLZ4DataCompressor>::New();
+      break;
+    case vtkExtractsDeliveryHelper::LZMA:
+      compressor = vtkSmartPointer<vtkLZMADataCompressor>::New();
+      break;
+    default:
+      return nullptr;
+  }
+  compressor->SetCompressionLevel(level);
+  return compressor;
+}
+
+// The data object is regenerated every time the producing algorithm
+// executes, which updates its update time, even if the output object itself
+// is reused.
+vtkMTimeType GetDataTime(vtkDataObject* dObj)
+{
+  return dObj ? std::max(dObj->GetMTime(), dObj->GetUpdateTime()) : 0;
+}
+}
 
 vtkStandardNewMacro(vtkExtractsDeliveryHelper);
 //----------------------------------------------------------------------------
@@ -37,6 +86,10 @@ vtkExtractsDeliveryHelper::vtkExtractsDeliveryHelper()
   : ProcessIsProducer(true)
   , NumberOfSimulationProcesses(0)
   , NumberOfVisualizationProcesses(0)
+  , CompressorType(NONE)
+  , CompressionLevel(1)
+  , MinimumDeliveryInterval(0.0)
+  , LastDeliveryTime(0.0)
 {
   this->SetParallelController(vtkMultiProcessController::GetGlobalController());
 }
@@ -69,6 +122,7 @@ void vtkExtractsDeliveryHelper::ClearAllExtracts()
 {
   this->ExtractConsumers.clear();
   this->ExtractProducers.clear();
+  this->DeliveredMTimes.clear();
   this->Modified();
 }
 
@@ -96,6 +150,7 @@ void vtkExtractsDeliveryHelper::AddExtractProducer(
   assert(key != nullptr && producerPort != nullptr);
 
   this->ExtractProducers[key] = producerPort;
+  this->DeliveredMTimes.erase(key);
 }
 
 //----------------------------------------------------------------------------
@@ -174,18 +229,60 @@ bool vtkExtractsDeliveryHelper::Update()
     int M = this->NumberOfSimulationProcesses;
     int N = this->NumberOfVisualizationProcesses;
 
+    // determine which extracts need to be shipped. Since collecting extracts is
+    // collective, all processes must agree on it. The last entry indicates that
+    // the delivery is being throttled, which is decided on the root.
+    const size_t numExtracts = this->ExtractProducers.size();
+    std::vector<int> deliver(numExtracts + 1, 0);
+    size_t index = 0;
+    for (ExtractProducersType::iterator iter = this->ExtractProducers.begin();
+         iter != this->ExtractProducers.end(); ++iter, ++index)
+    {
+      vtkDataObject* dObj =
+        iter->second->GetProducer()->GetOutputDataObject(iter->second->GetIndex());
+      auto delivered = this->DeliveredMTimes.find(iter->first);
+      const bool changed =
+        delivered == this->DeliveredMTimes.end() || ::GetDataTime(dObj) > delivered->second;
+      deliver[index] = changed ? 1 : 0;
+    }
+    const double now = vtkTimerLog::GetUniversalTime();
+    if (this->ParallelController->GetLocalProcessId() == 0 &&
+      now - this->LastDeliveryTime < this->MinimumDeliveryInterval)
+    {
+      deliver[numExtracts] = 1;
+    }
+    if (this->ParallelController->GetNumberOfProcesses() > 1)
+    {
+      std::vector<int> reduced(deliver.size(), 0);
+      this->ParallelController->AllReduce(deliver.data(), reduced.data(),
+        static_cast<vtkIdType>(deliver.size()), vtkCommunicator::MAX_OP);
+      deliver.swap(reduced);
+    }
+    if (deliver[numExtracts] != 0)
+    {
+      std::fill(deliver.begin(), deliver.end(), 0);
+    }
+    if (std::find(deliver.begin(), deliver.end(), 1) != deliver.end())
+    {
+      this->LastDeliveryTime = now;
+    }
+
     std::map<std::string, vtkSmartPointer<vtkDataObject>> gathered_extracts;
     if (M > N)
     {
       // when simulation processes in greater than vis processes, the simulation
       // processes will gather data on the first N processes and then ship that
       // over.
+      index = 0;
       for (ExtractProducersType::iterator iter = this->ExtractProducers.begin();
-           iter != this->ExtractProducers.end(); ++iter)
+           iter != this->ExtractProducers.end(); ++iter, ++index)
       {
-        vtkDataObject* dObj = this->Collect(
-          N, iter->second->GetProducer()->GetOutputDataObject(iter->second->GetIndex()));
-        gathered_extracts[iter->first].TakeReference(dObj);
+        if (deliver[index] != 0)
+        {
+          vtkDataObject* dObj = this->Collect(
+            N, iter->second->GetProducer()->GetOutputDataObject(iter->second->GetIndex()));
+          gathered_extracts[iter->first].TakeReference(dObj);
+        }
       }
     }
 
@@ -198,22 +295,44 @@ bool vtkExtractsDeliveryHelper::Update()
     vtkSocketController* comm = this->Simulation2VisualizationController;
     if (comm)
     {
+      index = 0;
       for (ExtractProducersType::iterator iter = this->ExtractProducers.begin();
-           iter != this->ExtractProducers.end(); ++iter)
+           iter != this->ExtractProducers.end(); ++iter, ++index)
       {
+        const int mode = deliver[index] != 0 ? EXTRACT_DATA : EXTRACT_UNCHANGED;
+        vtkDataObject* dObj = nullptr;
+        if (mode == EXTRACT_DATA)
+        {
+          dObj = (M > N)
+            ? gathered_extracts[iter->first].GetPointer()
+            : iter->second->GetProducer()->GetOutputDataObject(iter->second->GetIndex());
+        }
+        const int compressorType = dObj != nullptr ? this->CompressorType : NONE;
+
         vtkMultiProcessStream stream;
-        stream << iter->first;
+        stream << iter->first << mode << compressorType;
         comm->Send(stream, 1, 12000);
-        vtkDataObject* dObj = (M > N)
-          ? gathered_extracts[iter->first].GetPointer()
-          : iter->second->GetProducer()->GetOutputDataObject(iter->second->GetIndex());
-        comm->Send(dObj, 1, 12001);
+        if (mode == EXTRACT_DATA)
+        {
+          this->SendExtract(dObj, compressorType);
+        }
       }
       // mark end.
       vtkMultiProcessStream stream;
       stream << std::string("null");
       comm->Send(stream, 1, 12000);
     }
+
+    index = 0;
+    for (ExtractProducersType::iterator iter = this->ExtractProducers.begin();
+         iter != this->ExtractProducers.end(); ++iter, ++index)
+    {
+      if (deliver[index] != 0)
+      {
+        this->DeliveredMTimes[iter->first] = ::GetDataTime(
+          iter->second->GetProducer()->GetOutputDataObject(iter->second->GetIndex()));
+      }
+    }
   }
   else
   {
@@ -233,10 +352,30 @@ bool vtkExtractsDeliveryHelper::Update()
         {
           break;
         }
-        //        cout << "Received extract for: " << key.c_str() << endl;
-        vtkDataObject* extract = comm->ReceiveDataObject(1, 12001);
+        int mode, compressorType;
+        stream >> mode >> compressorType;
         ExtractConsumersType::iterator iter;
         iter = this->ExtractConsumers.find(key);
+
+        vtkDataObject* extract = nullptr;
+        if (mode == EXTRACT_DATA)
+        {
+          extract = this->ReceiveExtract(compressorType);
+          if (extract == nullptr)
+          {
+            vtkErrorMacro(
+              "Failed to receive extract " << key.c_str() << ". Keeping the previous one, if any.");
+          }
+        }
+        if (extract == nullptr && iter != this->ExtractConsumers.end() && iter->second.second)
+        {
+          // unchanged or not received; keep the extract received earlier.
+          extract = iter->second.first->GetOutputDataObject(0);
+          if (extract)
+          {
+            extract->Register(this);
+          }
+        }
         if (iter != this->ExtractConsumers.end())
         {
           iter->second.first->SetOutput(extract);
@@ -321,8 +460,76 @@ bool vtkExtractsDeliveryHelper::Update()
   return retVal;
 }
 
+//----------------------------------------------------------------------------
+void vtkExtractsDeliveryHelper::SendExtract(vtkDataObject* dObj, int compressorType)
+{
+  vtkSocketController* comm = this->Simulation2VisualizationController;
+  auto compressor = ::NewCompressor(compressorType, this->CompressionLevel);
+  if (!compressor)
+  {
+    comm->Send(dObj, 1, 12001);
+    return;
+  }
+
+  vtkNew<vtkCharArray> buffer;
+  vtkCommunicator::MarshalDataObject(dObj, buffer);
+  const size_t size = static_cast<size_t>(buffer->GetNumberOfValues());
+  std::vector<unsigned char> compressed(compressor->GetMaximumCompressionSpace(size));
+  const size_t compressedSize =
+    compressor->Compress(reinterpret_cast<const unsigned char*>(buffer->GetPointer(0)), size,
+      compressed.data(), compressed.size());
+
+  vtkIdType sizes[2] = { static_cast<vtkIdType>(size), static_cast<vtkIdType>(compressedSize) };
+  comm->Send(sizes, 2, 1, 12002);
+  comm->Send(reinterpret_cast<const char*>(compressed.data()), sizes[1], 1, 12003);
+}
+
+//----------------------------------------------------------------------------
+vtkDataObject* vtkExtractsDeliveryHelper::ReceiveExtract(int compressorType)
+{
+  vtkSocketController* comm = this->Simulation2VisualizationController;
+  if (compressorType == NONE)
+  {
+    return comm->ReceiveDataObject(1, 12001);
+  }
+
+  vtkIdType sizes[2];
+  comm->Receive(sizes, 2, 1, 12002);
+  std::vector<unsigned char> compressed(static_cast<size_t>(sizes[1]));
+  comm->Receive(reinterpret_cast<char*>(compressed.data()), sizes[1], 1, 12003);
+
+  auto compressor = ::NewCompressor(compressorType, this->CompressionLevel);
+  if (!compressor)
+  {
+    vtkErrorMacro("Unsupported compressor type " << compressorType << ".");
+    return nullptr;
+  }
+
+  vtkNew<vtkCharArray> buffer;
+  buffer->SetNumberOfValues(sizes[0]);
+  if (compressor->Uncompress(compressed.data(), compressed.size(),
+        reinterpret_cast<unsigned char*>(buffer->GetPointer(0)),
+        static_cast<size_t>(sizes[0])) != static_cast<size_t>(sizes[0]))
+  {
+    vtkErrorMacro("Failed to uncompress extract.");
+    return nullptr;
+  }
+
+  vtkSmartPointer<vtkDataObject> dObj = vtkCommunicator::UnMarshalDataObject(buffer);
+  if (!dObj)
+  {
+    vtkErrorMacro("Failed to unmarshal extract.");
+    return nullptr;
+  }
+  dObj->Register(this);
+  return dObj;
+}
+
 //----------------------------------------------------------------------------
 void vtkExtractsDeliveryHelper::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "CompressorType: " << this->CompressorType << endl;
+  os << indent << "CompressionLevel: " << this->CompressionLevel << endl;
+  os << indent << "MinimumDeliveryInterval: " << this->MinimumDeliveryInterval << endl;
 }
@@ -14,8 +14,18 @@
 =========================================================================*/
 /**
  * @class   vtkExtractsDeliveryHelper
+ * @brief   ships extracts from simulation processes to visualization processes.
  *
+ * vtkExtractsDeliveryHelper is used by vtkLiveInsituLink to deliver the
+ * registered extracts from the Catalyst (producer) processes to the ParaView
+ * Live (consumer) processes.
  *
+ * To limit the impact on the simulation, extracts whose data has not been
+ * modified since it was last delivered are not shipped again; the consumer
+ * simply keeps the data it received earlier. Payloads can optionally be
+ * compressed (see `SetCompressorType`) and deliveries can be rate limited
+ * using `SetMinimumDeliveryInterval` so that a slow consumer cannot make
+ * the simulation spend all of its time shipping extracts.
  */
 
 #ifndef vtkExtractsDeliveryHelper_h
@@ -26,6 +36,7 @@
 #include "vtkSmartPointer.h"       // needed for smart pointer
 
 class vtkAlgorithmOutput;
+class vtkCharArray;
 class vtkDataObject;
 class vtkMultiProcessController;
 class vtkSocketController;
@@ -71,15 +82,63 @@ public:
   vtkSetMacro(NumberOfSimulationProcesses, int);
   vtkGetMacro(NumberOfSimulationProcesses, int);
 
+  ///@{
+  /**
+   * Compressor to use for extracts shipped from the producer processes. The
+   * consumer processes determine the compressor from the received payload
+   * hence this only needs to be set on the producer side. Default is NONE.
+   */
+  enum CompressorType
+  {
+    NONE = 0,
+    ZLIB,
+    LZ4,
+    LZMA
+  };
+  vtkSetClampMacro(CompressorType, int, NONE, LZMA);
+  vtkGetMacro(CompressorType, int);
+  ///@}
+
+  ///@{
+  /**
+   * Compression level passed to the compressor, if any. Valid values are
+   * [1, 9], 1 being the fastest. Default is 1.
+   */
+  vtkSetClampMacro(CompressionLevel, int, 1, 9);
+  vtkGetMacro(CompressionLevel, int);
+  ///@}
+
+  ///@{
+  /**
+   * Minimum time, in seconds, between two deliveries of modified extracts.
+   * When `Update` is called before this interval has elapsed since the last
+   * delivery, no extracts are shipped and the consumer keeps the ones it has.
+   * 0 (default) delivers on every `Update`. Only used on the producer side.
+   */
+  vtkSetClampMacro(MinimumDeliveryInterval, double, 0.0, VTK_DOUBLE_MAX);
+  vtkGetMacro(MinimumDeliveryInterval, double);
+  ///@}
+
 protected:
   vtkExtractsDeliveryHelper();
   ~vtkExtractsDeliveryHelper() override;
 
   vtkDataObject* Collect(int nodes_to_collect_to, vtkDataObject*);
 
+  /**
+   * Send/receive an extract over the Simulation2VisualizationController,
+   * compressing it if requested.
+   */
+  void SendExtract(vtkDataObject* dObj, int compressorType);
+  vtkDataObject* ReceiveExtract(int compressorType);
+
   bool ProcessIsProducer;
   int NumberOfSimulationProcesses;
   int NumberOfVisualizationProcesses;
+  int CompressorType;
+  int CompressionLevel;
+  double MinimumDeliveryInterval;
+  double LastDeliveryTime;
 
   // the bool is to keep track of whether the trivial producer has had
   // its output set yet. we don't want to update the pipeline until
@@ -91,6 +150,9 @@ protected:
   typedef std::map<std::string, vtkSmartPointer<vtkAlgorithmOutput>> ExtractProducersType;
   ExtractProducersType ExtractProducers;
 
+  // the modification time of each extract when it was last delivered.
+  std::map<std::string, vtkMTimeType> DeliveredMTimes;
+
   vtkSmartPointer<vtkSocketController> Simulation2VisualizationController;
   vtkSmartPointer<vtkMultiProcessController> ParallelController;
 
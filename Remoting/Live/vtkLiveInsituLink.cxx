@@ -323,6 +323,8 @@ vtkLiveInsituLink::vtkLiveInsituLink()
   , InsituPort(0)
   , ProcessType(INSITU)
   , ProxyId(0)
+  , CompressorType(vtkExtractsDeliveryHelper::NONE)
+  , MinimumDeliveryInterval(0.0)
   , InsituXMLStateChanged(false)
   , ExtractsChanged(false)
   , SimulationPaused(0)
@@ -563,6 +565,8 @@ void vtkLiveInsituLink::InsituConnect(vtkMultiProcessController* proc0NodesContr
 
   this->ExtractsDeliveryHelper = vtkSmartPointer<vtkExtractsDeliveryHelper>::New();
   this->ExtractsDeliveryHelper->SetProcessIsProducer(this->ProcessType == LIVE ? false : true);
+  this->ExtractsDeliveryHelper->SetCompressorType(this->CompressorType);
+  this->ExtractsDeliveryHelper->SetMinimumDeliveryInterval(this->MinimumDeliveryInterval);
 
   vtkMultiProcessController* parallelController = vtkMultiProcessController::GetGlobalController();
   int numProcs = parallelController->GetNumberOfProcesses();
@@ -1226,6 +1230,8 @@ void vtkLiveInsituLink::UnRegisterExtract(vtkTrivialProducer* producer)
 void vtkLiveInsituLink::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "CompressorType: " << this->CompressorType << endl;
+  os << indent << "MinimumDeliveryInterval: " << this->MinimumDeliveryInterval << endl;
 }
 //----------------------------------------------------------------------------
 bool vtkLiveInsituLink::FilterXMLState(vtkPVXMLElement* xmlState)
@@ -40,6 +40,7 @@
 
 #include "vtkRemotingLiveModule.h" //needed for exports
 
+#include "vtkExtractsDeliveryHelper.h" // Needed for CompressorType
 #include "vtkSMObject.h"
 #include "vtkSmartPointer.h" // Needed for Smart pointer
 #include "vtkWeakPointer.h"  // Needed for Weak pointer
@@ -49,7 +50,6 @@ class vtkSMSessionProxyManager;
 class vtkPVXMLElement;
 class vtkPVSessionBase;
 class vtkTrivialProducer;
-class vtkExtractsDeliveryHelper;
 
 class VTKREMOTINGLIVE_EXPORT vtkLiveInsituLink : public vtkSMObject
 {
@@ -109,6 +109,29 @@ public:
   void SetSimulationPaused(int paused);
   ///@}
 
+  ///@{
+  /**
+   * Compressor used to ship extracts to ParaView Live. Accepted values are
+   * those of vtkExtractsDeliveryHelper::CompressorType. Only used on the
+   * insitu side. Default is vtkExtractsDeliveryHelper::NONE.
+   */
+  vtkSetClampMacro(
+    CompressorType, int, vtkExtractsDeliveryHelper::NONE, vtkExtractsDeliveryHelper::LZMA);
+  vtkGetMacro(CompressorType, int);
+  ///@}
+
+  ///@{
+  /**
+   * Minimum time, in seconds, between two deliveries of extracts to ParaView
+   * Live. When extracts are modified more often than this, intermediate
+   * timesteps are not shipped so that a slow ParaView Live client does not
+   * slow down the simulation. Only used on the insitu side. Default is 0 i.e.
+   * modified extracts are delivered every time `InsituPostProcess` is called.
+   */
+  vtkSetClampMacro(MinimumDeliveryInterval, double, 0.0, VTK_DOUBLE_MAX);
+  vtkGetMacro(MinimumDeliveryInterval, double);
+  ///@}
+
   /**
    * Initializes the link. For in situ this returns true it there is a
    * connection and false otherwise. For live it always returns true.
@@ -237,6 +260,8 @@ protected:
   int InsituPort;
   int ProcessType;
   unsigned int ProxyId;
+  int CompressorType;
+  double MinimumDeliveryInterval;
 
   bool InsituXMLStateChanged;
   bool ExtractsChanged;
@@ -0,0 +1,151 @@
+/*=========================================================================
+
+Program:   ParaView
+Module:    TestDeferDomainUpdates.cxx
+
+Copyright (c) Kitware, Inc.
+All rights reserved.
+See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+This software is distributed WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkCommand.h"
+#include "vtkInitializationHelper.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPVTestUtilities.h"
+#include "vtkProcessModule.h"
+#include "vtkSMParaViewPipelineController.h"
+#include "vtkSMProperty.h"
+#include "vtkSMPropertyHelper.h"
+#include "vtkSMProxyProperty.h"
+#include "vtkSMSession.h"
+#include "vtkSMSessionProxyManager.h"
+#include "vtkSMSourceProxy.h"
+#include "vtkSmartPointer.h"
+
+#include <string>
+#include <vector>
+
+// A filter with a property whose domain depends on the input's data
+// information.
+static const char* testDeferDomainUpdatesXML = R"==(
+<ServerManagerConfiguration>
+  <ProxyGroup name="filters">
+    <SourceProxy name="BoundsConsumer" class="vtkShrinkFilter">
+      <InputProperty command="SetInputConnection" name="Input">
+        <ProxyGroupDomain name="groups">
+          <Group name="sources" />
+          <Group name="filters" />
+        </ProxyGroupDomain>
+        <DataTypeDomain name="input_type">
+          <DataType value="vtkDataSet" />
+        </DataTypeDomain>
+      </InputProperty>
+      <DoubleVectorProperty command="SetShrinkFactor"
+                            default_values="0.5"
+                            name="Value"
+                            number_of_elements="1">
+        <BoundsDomain mode="magnitude" name="bounds">
+          <RequiredProperties>
+            <Property function="Input" name="Input" />
+          </RequiredProperties>
+        </BoundsDomain>
+      </DoubleVectorProperty>
+    </SourceProxy>
+  </ProxyGroup>
+</ServerManagerConfiguration>
+)==";
+
+namespace
+{
+class EventRecorder
+{
+public:
+  std::vector<std::string> Events;
+
+  void OnUpdateData() { this->Events.push_back("UpdateDataEvent"); }
+  void OnDomainModified() { this->Events.push_back("DomainModifiedEvent"); }
+
+  bool Check(const std::vector<std::string>& expected, const char* step)
+  {
+    if (this->Events != expected)
+    {
+      std::string actual;
+      for (const auto& event : this->Events)
+      {
+        actual += event + " ";
+      }
+      vtkLogF(ERROR, "%s: unexpected events '%s'.", step, actual.c_str());
+      return false;
+    }
+    this->Events.clear();
+    return true;
+  }
+};
+
+void SetRadius(vtkSMSourceProxy* sphere, double radius)
+{
+  vtkSMPropertyHelper(sphere, "Radius").Set(radius);
+  sphere->UpdateVTKObjects();
+  sphere->UpdatePipeline();
+}
+}
+
+int TestDeferDomainUpdates(int argc, char* argv[])
+{
+  vtkNew<vtkPVTestUtilities> testing;
+  testing->Initialize(argc, argv);
+  vtkInitializationHelper::Initialize(argv[0], vtkProcessModule::PROCESS_CLIENT);
+  vtkNew<vtkSMParaViewPipelineController> controller;
+
+  vtkNew<vtkSMSession> session;
+  controller->InitializeSession(session);
+  auto pxm = session->GetSessionProxyManager();
+  pxm->LoadConfigurationXML(testDeferDomainUpdatesXML);
+
+  auto sphere = vtkSmartPointer<vtkSMSourceProxy>::Take(
+    vtkSMSourceProxy::SafeDownCast(pxm->NewProxy("sources", "SphereSource")));
+  controller->InitializeProxy(sphere);
+  controller->RegisterPipelineProxy(sphere);
+  sphere->UpdatePipeline();
+
+  auto consumer = vtkSmartPointer<vtkSMSourceProxy>::Take(
+    vtkSMSourceProxy::SafeDownCast(pxm->NewProxy("filters", "BoundsConsumer")));
+  controller->PreInitializeProxy(consumer);
+  vtkSMPropertyHelper(consumer, "Input").Set(sphere);
+  controller->PostInitializeProxy(consumer);
+  controller->RegisterPipelineProxy(consumer);
+
+  // The consumer's input property observes UpdateDataEvent before the recorder
+  // does. Domains are nonetheless updated after all the observers of the
+  // producer's UpdateDataEvent, once vtkSMProxy::PostUpdateData() is done.
+  EventRecorder recorder;
+  sphere->AddObserver(vtkCommand::UpdateDataEvent, &recorder, &EventRecorder::OnUpdateData);
+  consumer->GetProperty("Value")->AddObserver(
+    vtkCommand::DomainModifiedEvent, &recorder, &EventRecorder::OnDomainModified);
+
+  bool success = true;
+  SetRadius(sphere, 2.0);
+  success &= recorder.Check({ "UpdateDataEvent", "DomainModifiedEvent" }, "PostUpdateData");
+
+  // Nested scopes: the domains are only updated when the outermost one ends.
+  {
+    vtkSMProxyProperty::DeferDomainUpdates outer;
+    {
+      vtkSMProxyProperty::DeferDomainUpdates inner;
+      SetRadius(sphere, 3.0);
+    }
+    success &= recorder.Check({ "UpdateDataEvent" }, "Inner scope");
+    SetRadius(sphere, 4.0);
+    success &= recorder.Check({ "UpdateDataEvent" }, "Outer scope");
+  }
+  // The property is queued once, however many times its input is updated.
+  success &= recorder.Check({ "DomainModifiedEvent" }, "End of outer scope");
+
+  vtkInitializationHelper::Finalize();
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
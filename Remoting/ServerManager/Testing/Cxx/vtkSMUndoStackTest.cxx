@@ -25,6 +25,38 @@ PURPOSE.  See the above copyright notice for more information.
 #include "vtkSMUndoStack.h"
 #include "vtkUndoSet.h"
 
+namespace
+{
+// Sets the radius of the sphere and pushes the change on the undo stack.
+void PushRadiusChange(vtkSMUndoStack* undoStack, vtkSMSession* session, vtkSMProxy* sphere,
+  double radius, const char* label)
+{
+  vtkSMMessage before;
+  before.CopyFrom(*sphere->GetFullState());
+  vtkSMPropertyHelper(sphere, "Radius").Set(radius);
+  sphere->UpdateVTKObjects();
+  vtkSMMessage after;
+  after.CopyFrom(*sphere->GetFullState());
+
+  vtkSMRemoteObjectUpdateUndoElement* undoElement = vtkSMRemoteObjectUpdateUndoElement::New();
+  undoElement->SetSession(session);
+  undoElement->SetUndoRedoState(&before, &after);
+  vtkUndoSet* undoSet = vtkUndoSet::New();
+  undoSet->AddElement(undoElement);
+  undoElement->Delete();
+  undoStack->Push(label, undoSet);
+  undoSet->Delete();
+}
+
+// Counts the PushUndoSetEvent fired by an undo stack.
+class PushCounter
+{
+public:
+  int Count = 0;
+  void OnPush() { ++this->Count; }
+};
+}
+
 void vtkSMUndoStackTest::UndoRedo()
 {
   vtkSMSession* session = vtkSMSession::New();
@@ -77,3 +109,113 @@ void vtkSMUndoStackTest::StackDepth()
   QCOMPARE(stack->GetStackDepth(), 10);
   stack->Delete();
 }
+
+void vtkSMUndoStackTest::CoalesceUndoSets()
+{
+  vtkSMSession* session = vtkSMSession::New();
+  vtkSMSessionProxyManager* pxm = session->GetSessionProxyManager();
+
+  vtkSMProxy* sphere = pxm->NewProxy("sources", "SphereSource");
+  vtkSMProxy* otherSphere = pxm->NewProxy("sources", "SphereSource");
+  sphere->UpdateVTKObjects();
+  otherSphere->UpdateVTKObjects();
+
+  vtkSMUndoStack* undoStack = vtkSMUndoStack::New();
+  PushCounter pushEvents;
+  undoStack->AddObserver(vtkSMUndoStack::PushUndoSetEvent, &pushEvents, &PushCounter::OnPush);
+
+  // Outside of a coalescing scope, every push is a new undo set.
+  PushRadiusChange(undoStack, session, sphere, 1.0, "ChangeRadius");
+  PushRadiusChange(undoStack, session, sphere, 2.0, "ChangeRadius");
+  QCOMPARE(undoStack->GetNumberOfUndoSets(), 2u);
+  QCOMPARE(pushEvents.Count, 2);
+
+  // Within one, successive changes to the same proxy with the same label are
+  // coalesced, but not with the set pushed before the scope began.
+  undoStack->BeginCoalescing();
+  QVERIFY(undoStack->GetCoalescing());
+  PushRadiusChange(undoStack, session, sphere, 3.0, "ChangeRadius");
+  PushRadiusChange(undoStack, session, sphere, 4.0, "ChangeRadius");
+  PushRadiusChange(undoStack, session, sphere, 5.0, "ChangeRadius");
+  QCOMPARE(undoStack->GetNumberOfUndoSets(), 3u);
+  // PushUndoSetEvent is only fired for the first set of the scope.
+  QCOMPARE(pushEvents.Count, 3);
+
+  // Other labels or proxies are not.
+  PushRadiusChange(undoStack, session, sphere, 6.0, "Other");
+  QCOMPARE(undoStack->GetNumberOfUndoSets(), 4u);
+  PushRadiusChange(undoStack, session, otherSphere, 7.0, "Other");
+  QCOMPARE(undoStack->GetNumberOfUndoSets(), 5u);
+  QCOMPARE(pushEvents.Count, 5);
+  undoStack->EndCoalescing();
+  QVERIFY(!undoStack->GetCoalescing());
+
+  undoStack->Undo();
+  undoStack->Undo();
+  sphere->UpdateVTKObjects();
+  otherSphere->UpdateVTKObjects();
+  QCOMPARE(vtkSMPropertyHelper(sphere, "Radius").GetAsDouble(), 5.0);
+  QCOMPARE(vtkSMPropertyHelper(otherSphere, "Radius").GetAsDouble(), 0.5);
+
+  // The coalesced set restores the state before its first change...
+  undoStack->Undo();
+  sphere->UpdateVTKObjects();
+  QCOMPARE(vtkSMPropertyHelper(sphere, "Radius").GetAsDouble(), 2.0);
+
+  // ...and redoes the last one.
+  undoStack->Redo();
+  sphere->UpdateVTKObjects();
+  QCOMPARE(vtkSMPropertyHelper(sphere, "Radius").GetAsDouble(), 5.0);
+
+  // Changes pushed after an undo or a redo start a new undo set, even within a
+  // coalescing scope, and coalescing clears the redo stack as pushing does.
+  undoStack->BeginCoalescing();
+  PushRadiusChange(undoStack, session, sphere, 8.0, "ChangeRadius");
+  QCOMPARE(undoStack->GetNumberOfUndoSets(), 4u);
+  undoStack->Undo();
+  undoStack->Redo();
+  PushRadiusChange(undoStack, session, sphere, 9.0, "ChangeRadius");
+  PushRadiusChange(undoStack, session, sphere, 10.0, "ChangeRadius");
+  QCOMPARE(undoStack->GetNumberOfUndoSets(), 5u);
+  QVERIFY(static_cast<bool>(undoStack->CanRedo()) == false);
+  undoStack->EndCoalescing();
+
+  undoStack->Delete();
+  otherSphere->Delete();
+  sphere->Delete();
+  session->Delete();
+}
+
+void vtkSMUndoStackTest::MemoryLimit()
+{
+  vtkSMSession* session = vtkSMSession::New();
+  vtkSMSessionProxyManager* pxm = session->GetSessionProxyManager();
+
+  vtkSMProxy* sphere = pxm->NewProxy("sources", "SphereSource");
+  sphere->UpdateVTKObjects();
+
+  vtkSMUndoStack* undoStack = vtkSMUndoStack::New();
+  QCOMPARE(undoStack->GetMemoryLimit(), static_cast<vtkIdType>(64 * 1024 * 1024));
+
+  // Distinct labels, so that the sets are not coalesced.
+  PushRadiusChange(undoStack, session, sphere, 1.0, "Change1");
+  PushRadiusChange(undoStack, session, sphere, 2.0, "Change2");
+  PushRadiusChange(undoStack, session, sphere, 3.0, "Change3");
+  QCOMPARE(undoStack->GetNumberOfUndoSets(), 3u);
+
+  // A limit smaller than any set only keeps the most recent one.
+  undoStack->SetMemoryLimit(1);
+  PushRadiusChange(undoStack, session, sphere, 4.0, "Change4");
+  QCOMPARE(undoStack->GetNumberOfUndoSets(), 1u);
+  QCOMPARE(undoStack->GetUndoSetLabel(0), "Change4");
+
+  // No limit.
+  undoStack->SetMemoryLimit(0);
+  PushRadiusChange(undoStack, session, sphere, 5.0, "Change5");
+  PushRadiusChange(undoStack, session, sphere, 6.0, "Change6");
+  QCOMPARE(undoStack->GetNumberOfUndoSets(), 3u);
+
+  undoStack->Delete();
+  sphere->Delete();
+  session->Delete();
+}
@@ -25,6 +25,8 @@ class vtkSMUndoStackTest : public QObject
 private Q_SLOTS:
   void UndoRedo();
   void StackDepth();
+  void CoalesceUndoSets();
+  void MemoryLimit();
 };
 
 #endif
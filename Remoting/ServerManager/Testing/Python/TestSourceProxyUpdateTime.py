@@ -0,0 +1,61 @@
+# Tests that vtkSMSourceProxy::UpdatePipeline(time) only keeps the cached data
+# information when neither the time nor the proxy changed since the last update.
+
+from paraview.simple import *
+from paraview import smtesting
+smtesting.ProcessCommandLineArguments()
+
+# The source produces int(scale * time) + 1 points, scale being substituted in
+# the script.
+SCRIPT = """from vtkmodules.vtkCommonCore import vtkPoints
+executive = self.GetExecutive()
+outInfo = executive.GetOutputInformation(0)
+t = outInfo.Get(executive.UPDATE_TIME_STEP()) if outInfo.Has(executive.UPDATE_TIME_STEP()) else 0
+points = vtkPoints()
+for i in range(int(%d * t) + 1):
+    points.InsertNextPoint(i, 0, 0)
+self.GetPolyDataOutput().SetPoints(points)"""
+
+source = ProgrammableSource()
+source.OutputDataSetType = 'vtkPolyData'
+source.ScriptRequestInformation = """executive = self.GetExecutive()
+outInfo = executive.GetOutputInformation(0)
+outInfo.Remove(executive.TIME_STEPS())
+for t in range(4):
+    outInfo.Append(executive.TIME_STEPS(), t)
+outInfo.Set(executive.TIME_RANGE(), [0, 3], 2)"""
+source.Script = SCRIPT % 1
+
+
+def check(time, expected):
+    source.UpdatePipeline(time)
+    numPoints = source.GetDataInformation().GetNumberOfPoints()
+    if numPoints != expected:
+        raise RuntimeError("At time %g, expected %d points, got %d" % (time, expected, numPoints))
+    return source.SMProxy.GetDataInformation(0).GetMTime()
+
+
+check(1, 2)
+check(2, 3)
+
+# Same time, nothing modified: the data information is not gathered again.
+mtime = check(2, 3)
+if check(2, 3) != mtime:
+    raise RuntimeError("Data information was gathered again for an unchanged update.")
+
+# Modifying the proxy invalidates the remembered time.
+source.Script = SCRIPT % 2
+check(2, 5)
+
+# Updating a view at another time updates the pipeline at that time and the
+# next update at the previous time must not reuse its data information.
+view = CreateRenderView()
+Show(source, view)
+view.ViewTime = 1
+Render(view)
+if source.GetDataInformation().GetNumberOfPoints() != 3:
+    raise RuntimeError("Data information does not match the view time.")
+check(2, 5)
+check(1, 3)
+
+Delete(view)
@@ -33,11 +33,14 @@
 #include "vtkStringList.h"
 #include "vtkTimerLog.h"
 
+#include <atomic>
 #include <cassert>
 #include <map>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <vtksys/RegularExpression.hxx>
@@ -56,6 +59,8 @@ public:
   bool EnableXMLProxyDefinitionUpdate;
   // To know if override need to be taken into account and replaced in the parent
   bool ReplaceOverrideInParent;
+  // Whether the plugin XMLs go through the process-wide parse cache
+  bool UseParseCache;
   // Keep track of ServerManager definition
   StrToStrToXmlMap CoreDefinitions;
   // Keep track of custom definition
@@ -64,6 +69,7 @@ public:
   vtkInternals()
     : EnableXMLProxyDefinitionUpdate(true)
     , ReplaceOverrideInParent(true)
+    , UseParseCache(false)
   {
   }
   //-------------------------------------------------------------------------
@@ -416,6 +422,62 @@ private:
   bool InvalidCustomIterator;
 };
 
+//****************************************************************************
+namespace
+{
+// Number of vtkSIProxyDefinitionManager created in this process.
+std::atomic<int> vtkNumberOfDefinitionManagers(0);
+
+//----------------------------------------------------------------------------
+// Every session creates its own vtkSIProxyDefinitionManager which loads the
+// same plugin XMLs again. Once a second manager is created in the process, the
+// parsed XMLs are kept, by content, and each manager gets a copy of them since
+// loading the definitions modifies the elements (extensions, ShowInMenu
+// hints). The first manager parses the XMLs directly and does not pay for the
+// cache.
+XMLElement vtkParsePluginXML(const std::string& xmlContent, bool useCache)
+{
+  static std::mutex CacheMutex;
+  static std::unordered_map<std::string, XMLElement> Cache;
+
+  if (!useCache)
+  {
+    vtkNew<vtkPVXMLParser> parser;
+    if (!parser->Parse(xmlContent.c_str()))
+    {
+      return nullptr;
+    }
+    return parser->GetRootElement();
+  }
+
+  XMLElement parsed;
+  {
+    std::lock_guard<std::mutex> lock(CacheMutex);
+    auto iter = Cache.find(xmlContent);
+    if (iter != Cache.end())
+    {
+      parsed = iter->second;
+    }
+  }
+  if (!parsed)
+  {
+    vtkNew<vtkPVXMLParser> parser;
+    if (!parser->Parse(xmlContent.c_str()))
+    {
+      return nullptr;
+    }
+    parsed = parser->GetRootElement();
+
+    std::lock_guard<std::mutex> lock(CacheMutex);
+    Cache.emplace(xmlContent, parsed);
+  }
+
+  XMLElement copy = XMLElement::New();
+  parsed->CopyTo(copy);
+  return copy;
+}
+}
+
 //****************************************************************************
 vtkStandardNewMacro(vtkSIProxyDefinitionManager);
 vtkStandardNewMacro(vtkInternalDefinitionIterator);
@@ -425,6 +487,7 @@ vtkSIProxyDefinitionManager::vtkSIProxyDefinitionManager()
 {
   this->Internals = new vtkInternals;
   this->InternalsFlatten = new vtkInternals;
+  this->Internals->UseParseCache = vtkNumberOfDefinitionManagers++ > 0;
 
   vtkPVPluginTracker* tracker = vtkPVPluginTracker::GetInstance();
 
@@ -1201,10 +1264,13 @@ void vtkSIProxyDefinitionManager::HandlePlugin(vtkPVPlugin* plugin)
       this->Internals->ReplaceOverrideInParent = false;
       for (size_t cc = 0; cc < xmls.size(); cc++)
       {
-        this->LoadConfigurationXMLFromString(xmls[cc].c_str(),
-          // if GetPluginName() == vtkPVInitializerPlugin, it implies that it's
-          // the ParaView core and should not be treated as plugin.
-          strcmp(plugin->GetPluginName(), "vtkPVInitializerPlugin") != 0);
+        if (XMLElement root = vtkParsePluginXML(xmls[cc], this->Internals->UseParseCache))
+        {
+          this->LoadConfigurationXML(root,
+            // if GetPluginName() == vtkPVInitializerPlugin, it implies that it's
+            // the ParaView core and should not be treated as plugin.
+            strcmp(plugin->GetPluginName(), "vtkPVInitializerPlugin") != 0);
+        }
       }
 
       // Make sure we invalidate any cached flatten version of our proxy definition
@@ -58,6 +58,7 @@ vtkSISourceProxy::vtkSISourceProxy()
   this->PortsCreated = false;
   this->StartEventCounter = 0;
   this->DisablePipelineExecution = false;
+  this->AllowTemporalCache = false;
 }
 
 //----------------------------------------------------------------------------
@@ -126,6 +127,11 @@ void vtkSISourceProxy::OnCreateVTKObjects()
       }
     }
   }
+
+  if (this->AllowTemporalCache)
+  {
+    algorithm->GetInformation()->Set(vtkPVCompositeDataPipeline::ALLOW_TEMPORAL_CACHE(), 1);
+  }
 }
 
 //----------------------------------------------------------------------------
@@ -204,6 +210,12 @@ bool vtkSISourceProxy::ReadXMLAttributes(vtkPVXMLElement* element)
   {
     this->SetExecutiveName(executiveName);
   }
+
+  int allowTemporalCache = 0;
+  if (element->GetScalarAttribute("temporal_cache", &allowTemporalCache))
+  {
+    this->AllowTemporalCache = (allowTemporalCache != 0);
+  }
   return true;
 }
 
@@ -112,6 +112,10 @@ protected:
   vtkSetStringMacro(ExecutiveName);
   bool DisablePipelineExecution;
 
+  // Set from the `temporal_cache` XML attribute to let vtkPVCompositeDataPipeline
+  // cache the outputs of the algorithm.
+  bool AllowTemporalCache;
+
   friend class vtkSICompoundSourceProxy;
 
 private:
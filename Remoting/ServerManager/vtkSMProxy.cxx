@@ -1248,6 +1248,10 @@ vtkSMProperty* vtkSMProxy::GetProducerProperty(unsigned int idx)
 //----------------------------------------------------------------------------
 void vtkSMProxy::PostUpdateData(bool using_cache)
 {
+  // Producers fire UpdateDataEvent one after the other; update the domains
+  // depending on them once all of them are done.
+  vtkSMProxyProperty::DeferDomainUpdates deferDomainUpdates;
+
   unsigned int numProducers = this->GetNumberOfProducers();
   for (unsigned int i = 0; i < numProducers; i++)
   {
@@ -30,8 +30,11 @@
 #include "vtkSMSessionProxyManager.h"
 #include "vtkSMStateLocator.h"
 #include "vtkSmartPointer.h"
+#include "vtkWeakPointer.h"
 
 #include <cassert>
+#include <map>
+#include <vector>
 
 namespace
 {
@@ -50,10 +53,45 @@ void vtkGetProxyListValues(
     tvalues.push_back(tvalue);
   }
 }
+
+// Number of vtkSMProxyProperty::DeferDomainUpdates instances in scope.
+unsigned int vtkDeferDomainUpdatesCount = 0;
+
+// Properties whose domain updates are deferred, in the order they were
+// requested. The map is used to avoid queuing the same property twice.
+std::vector<vtkWeakPointer<vtkSMProxyProperty>> vtkPendingDomainUpdates;
+std::map<vtkSMProxyProperty*, size_t> vtkPendingDomainUpdatesIndex;
 }
 
 bool vtkSMProxyProperty::CreateProxyAllowed = false; // static init
 
+//---------------------------------------------------------------------------
+vtkSMProxyProperty::DeferDomainUpdates::DeferDomainUpdates()
+{
+  ++vtkDeferDomainUpdatesCount;
+}
+
+//---------------------------------------------------------------------------
+vtkSMProxyProperty::DeferDomainUpdates::~DeferDomainUpdates()
+{
+  assert(vtkDeferDomainUpdatesCount > 0);
+  if (--vtkDeferDomainUpdatesCount == 0)
+  {
+    // Swap the queue out first: the count is now zero, so anything triggered
+    // by these domain updates is handled immediately and not queued.
+    std::vector<vtkWeakPointer<vtkSMProxyProperty>> pending;
+    pending.swap(vtkPendingDomainUpdates);
+    vtkPendingDomainUpdatesIndex.clear();
+    for (const auto& prop : pending)
+    {
+      if (prop)
+      {
+        prop->UpdateDomains();
+      }
+    }
+  }
+}
+
 //***************************************************************************
 vtkStandardNewMacro(vtkSMProxyProperty);
 //---------------------------------------------------------------------------
@@ -462,6 +500,26 @@ int vtkSMProxyProperty::LoadState(vtkPVXMLElement* element, vtkSMProxyLocator* l
   return 1;
 }
 
+//---------------------------------------------------------------------------
+void vtkSMProxyProperty::OnUpdateDataEvent()
+{
+  if (vtkDeferDomainUpdatesCount == 0)
+  {
+    this->UpdateDomains();
+    return;
+  }
+
+  // A queued entry may have been released and its address reused by this
+  // property, hence the check on the weak pointer.
+  auto iter = vtkPendingDomainUpdatesIndex.find(this);
+  if (iter == vtkPendingDomainUpdatesIndex.end() ||
+    vtkPendingDomainUpdates[iter->second] != this)
+  {
+    vtkPendingDomainUpdatesIndex[this] = vtkPendingDomainUpdates.size();
+    vtkPendingDomainUpdates.push_back(this);
+  }
+}
+
 //---------------------------------------------------------------------------
 void vtkSMProxyProperty::UpdateAllInputs()
 {
@@ -181,6 +181,29 @@ public:
    */
   void ResetToXMLDefaults() override;
 
+  /**
+   * @class vtkSMProxyProperty::DeferDomainUpdates
+   * @brief helper to defer domain updates caused by producers' data updates.
+   *
+   * While an instance of this class is in scope, dependent domains are not
+   * updated immediately when a proxy added to a vtkSMProxyProperty fires
+   * vtkCommand::UpdateDataEvent. Instead, the property is queued and its
+   * domains are updated once when the outermost instance goes out of scope.
+   * This avoids updating the domains of a property with many inputs once for
+   * every input when all of them are updated together, e.g. in
+   * vtkSMProxy::PostUpdateData() or vtkSMViewProxy::Update().
+   */
+  class VTKREMOTINGSERVERMANAGER_EXPORT DeferDomainUpdates
+  {
+  public:
+    DeferDomainUpdates();
+    ~DeferDomainUpdates();
+
+  private:
+    DeferDomainUpdates(const DeferDomainUpdates&) = delete;
+    void operator=(const DeferDomainUpdates&) = delete;
+  };
+
 protected:
   vtkSMProxyProperty();
   ~vtkSMProxyProperty() override;
@@ -222,9 +245,10 @@ protected:
 
   /**
    * Called when a producer fires the vtkCommand::UpdateDataEvent. We update all
-   * dependent domains since the data-information may have changed.
+   * dependent domains since the data-information may have changed. The update
+   * is queued if a DeferDomainUpdates instance is in scope.
    */
-  void OnUpdateDataEvent() { this->UpdateDomains(); }
+  void OnUpdateDataEvent();
 
   // Static flag used to know if the locator should be used to create proxy
   // or if the session should be used to find only the existing ones
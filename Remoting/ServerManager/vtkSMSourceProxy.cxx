@@ -90,6 +90,12 @@ struct vtkSMSourceProxyInternals
   std::vector<vtkSmartPointer<vtkSMSourceProxy>> SelectionProxies;
   std::vector<unsigned long> SelectionObservers;
 
+  // Time used by the last call to UpdatePipeline(double). Reset whenever the
+  // data information is invalidated, so that it is valid only as long as the
+  // output data is known to be the result of that update.
+  bool UpdateTimeValid = false;
+  double UpdateTime = 0.0;
+
   // Resizes output ports and ensures that Name for each port is initialized to
   // the default.
   void ResizeOutputPorts(unsigned int newsize)
@@ -353,6 +359,13 @@ void vtkSMSourceProxy::UpdatePipeline(double time)
 {
   int i;
 
+  // If nothing was modified since the last update with the same time, the
+  // output data cannot have changed and the cached data information is still
+  // valid. Avoid invalidating it since that results in every consumer
+  // (information panel, spreadsheet, range domains...) gathering it again.
+  const bool unchanged =
+    !this->NeedsUpdate && this->PInternals->UpdateTimeValid && this->PInternals->UpdateTime == time;
+
   this->CreateOutputPorts();
   int num = this->GetNumberOfOutputPorts();
   for (i = 0; i < num; ++i)
@@ -367,10 +380,15 @@ void vtkSMSourceProxy::UpdatePipeline(double time)
   // set the NeedsUpdate ivar to true as well. Otherwise PostUpdateData()
   // doesn't fire the necessary events and that can cause problems (BUG
   // #12571).
-  this->NeedsUpdate = true;
-
-  this->PostUpdateData(false);
+  if (!unchanged)
+  {
+    this->NeedsUpdate = true;
+    this->PostUpdateData(false);
+  }
   // this->InvalidateDataInformation();
+
+  this->PInternals->UpdateTimeValid = true;
+  this->PInternals->UpdateTime = time;
 }
 
 //---------------------------------------------------------------------------
@@ -512,6 +530,9 @@ void vtkSMSourceProxy::RemoveAllExtractSelectionProxies()
 //----------------------------------------------------------------------------
 void vtkSMSourceProxy::PostUpdateData(bool using_cache)
 {
+  // The pipeline may have been updated for another time than the one
+  // remembered by UpdatePipeline(double), even when using the cache.
+  this->PInternals->UpdateTimeValid = false;
   if (!using_cache)
   {
     this->InvalidateDataInformation();
@@ -533,6 +554,7 @@ void vtkSMSourceProxy::MarkDirty(vtkSMProxy* modifiedProxy)
   }
 
   this->Superclass::MarkDirty(modifiedProxy);
+  this->PInternals->UpdateTimeValid = false;
   // this->InvalidateDataInformation();
 }
 
@@ -589,6 +611,7 @@ vtkPVDataInformation* vtkSMSourceProxy::GetSubsetDataInformation(
 //----------------------------------------------------------------------------
 void vtkSMSourceProxy::InvalidateDataInformation()
 {
+  this->PInternals->UpdateTimeValid = false;
   if (this->OutputPortsCreated)
   {
     vtkSMSourceProxyInternals::VectorOfPorts::iterator it = this->PInternals->OutputPorts.begin();
@@ -59,6 +59,12 @@ struct vtkSMStateLoaderInternals
   ProxyCreationOrderType ProxyCreationOrder;
   bool DeferProxyRegistration;
 
+  /// Index of the "Proxy" elements under IndexedRoot, by id. Built on first use
+  /// by LocateProxyElement() so that resolving proxy references does not scan
+  /// the whole state each time.
+  std::map<vtkIdType, vtkPVXMLElement*> ProxyElementIndex;
+  vtkPVXMLElement* IndexedRoot = nullptr;
+
   vtkSMStateLoaderInternals()
     : KeepOriginalId(false)
     , DeferProxyRegistration(false)
@@ -315,7 +321,42 @@ bool vtkSMStateLoader::UpdateRegistrationInfo(
 //---------------------------------------------------------------------------
 vtkPVXMLElement* vtkSMStateLoader::LocateProxyElement(vtkTypeUInt32 id)
 {
-  return this->LocateProxyElementInternal(this->ServerManagerStateElement, id);
+  if (!this->ServerManagerStateElement)
+  {
+    return this->LocateProxyElementInternal(this->ServerManagerStateElement, id);
+  }
+
+  if (this->Internal->IndexedRoot != this->ServerManagerStateElement)
+  {
+    this->Internal->ProxyElementIndex.clear();
+    this->BuildProxyElementIndex(this->ServerManagerStateElement);
+    this->Internal->IndexedRoot = this->ServerManagerStateElement;
+  }
+
+  auto iter = this->Internal->ProxyElementIndex.find(static_cast<vtkIdType>(id));
+  return iter != this->Internal->ProxyElementIndex.end() ? iter->second : nullptr;
+}
+
+//---------------------------------------------------------------------------
+void vtkSMStateLoader::BuildProxyElementIndex(vtkPVXMLElement* root)
+{
+  // Visit elements in the same order as LocateProxyElementInternal() and keep
+  // the first element for each id, so that both return the same element.
+  unsigned int numElems = root->GetNumberOfNestedElements();
+  for (unsigned int i = 0; i < numElems; i++)
+  {
+    vtkPVXMLElement* currentElement = root->GetNestedElement(i);
+    vtkIdType currentId;
+    if (currentElement->GetName() && strcmp(currentElement->GetName(), "Proxy") == 0 &&
+      currentElement->GetScalarAttribute("id", &currentId))
+    {
+      this->Internal->ProxyElementIndex.emplace(currentId, currentElement);
+    }
+  }
+  for (unsigned int i = 0; i < numElems; i++)
+  {
+    this->BuildProxyElementIndex(root->GetNestedElement(i));
+  }
 }
 
 //---------------------------------------------------------------------------
@@ -585,6 +626,19 @@ int vtkSMStateLoader::LoadStateInternal(vtkPVXMLElement* parent)
     return 0;
   }
 
+  // The state element, and the proxy element index built from it, are only
+  // valid during this call. Reset both on every return, including errors, so
+  // that no later lookup sees dangling pointers.
+  struct StateElementReset
+  {
+    vtkSMStateLoader* Self;
+    ~StateElementReset()
+    {
+      this->Self->Internal->ProxyElementIndex.clear();
+      this->Self->Internal->IndexedRoot = nullptr;
+      this->Self->ServerManagerStateElement = nullptr;
+    }
+  } stateElementReset{ this };
   this->ServerManagerStateElement = rootElement;
 
   unsigned int numElems = rootElement->GetNumberOfNestedElements();
@@ -727,7 +781,6 @@ int vtkSMStateLoader::LoadStateInternal(vtkPVXMLElement* parent)
   // Clear internal data structures.
   this->Internal->ProxyCreationOrder.clear();
   this->Internal->RegistrationInformation.clear();
-  this->ServerManagerStateElement = nullptr;
   return 1;
 }
 
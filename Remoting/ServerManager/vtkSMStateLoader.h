@@ -142,9 +142,16 @@ protected:
    * Return the xml element for the state of the proxy with the given id.
    * This is used by NewProxy() when the proxy with the given id
    * is not located in the internal CreatedProxies map.
+   * The elements are looked up in an index of the state built on first use.
    */
   vtkPVXMLElement* LocateProxyElement(vtkTypeUInt32 id) override;
 
+  /**
+   * Used by LocateProxyElement(). Adds all the proxy state elements nested in
+   * root to the index of proxy elements by id.
+   */
+  void BuildProxyElementIndex(vtkPVXMLElement* root);
+
   /**
    * Used by LocateProxyElement(). Recursively tries to locate the
    * proxy state element for the proxy.
@@ -29,6 +29,7 @@
 #include "vtkSMUndoElement.h"
 #include "vtkUndoSet.h"
 #include "vtkUndoStackInternal.h"
+#include "vtkWeakPointer.h"
 
 #include "vtkNew.h"
 #include <set>
@@ -44,6 +45,9 @@ public:
   vtkNew<vtkSMDeserializerProtobuf> UndoSetProxyDeserializer;
   vtkNew<vtkSMStateLocator> UndoSetStateLocator;
 
+  // The last undo set pushed within the current coalescing scope, if any.
+  vtkWeakPointer<vtkUndoSet> CoalescingTarget;
+
   vtkInternal()
   {
     this->UndoSetProxyDeserializer->SetStateLocator(this->UndoSetStateLocator.GetPointer());
@@ -123,12 +127,41 @@ public:
     }
   }
 };
+
+namespace
+{
+// Returns the size of the serialized states held by the undo set.
+vtkIdType vtkGetUndoSetStateSize(vtkUndoSet* undoSet)
+{
+  vtkIdType size = 0;
+  for (int cc = 0, max = undoSet->GetNumberOfElements(); cc < max; ++cc)
+  {
+    if (auto elem = vtkSMRemoteObjectUpdateUndoElement::SafeDownCast(undoSet->GetElement(cc)))
+    {
+      size += static_cast<vtkIdType>(
+        elem->BeforeState->ByteSizeLong() + elem->AfterState->ByteSizeLong());
+    }
+  }
+  return size;
+}
+
+// Returns the element of an undo set that only updates a single object.
+vtkSMRemoteObjectUpdateUndoElement* vtkGetSingleUpdateElement(vtkUndoSet* undoSet)
+{
+  return (undoSet && undoSet->GetNumberOfElements() == 1)
+    ? vtkSMRemoteObjectUpdateUndoElement::SafeDownCast(undoSet->GetElement(0))
+    : nullptr;
+}
+}
+
 //*****************************************************************************
 vtkStandardNewMacro(vtkSMUndoStack);
 //-----------------------------------------------------------------------------
 vtkSMUndoStack::vtkSMUndoStack()
 {
   this->Internal = new vtkInternal();
+  this->MemoryLimit = 64 * 1024 * 1024;
+  this->CoalescingCount = 0;
 }
 
 //-----------------------------------------------------------------------------
@@ -141,8 +174,95 @@ vtkSMUndoStack::~vtkSMUndoStack()
 //-----------------------------------------------------------------------------
 void vtkSMUndoStack::Push(const char* label, vtkUndoSet* changeSet)
 {
-  this->Superclass::Push(label, changeSet);
-  this->InvokeEvent(PushUndoSetEvent, changeSet);
+  const bool coalesced = this->CoalesceWithTop(label, changeSet);
+  if (coalesced)
+  {
+    this->vtkUndoStack::Internal->RedoStack.clear();
+    this->Modified();
+  }
+  else
+  {
+    this->Superclass::Push(label, changeSet);
+    if (this->CoalescingCount > 0)
+    {
+      this->Internal->CoalescingTarget = changeSet;
+    }
+  }
+
+  if (this->MemoryLimit > 0)
+  {
+    auto& undoStack = this->vtkUndoStack::Internal->UndoStack;
+    vtkIdType totalSize = 0;
+    for (const auto& element : undoStack)
+    {
+      totalSize += ::vtkGetUndoSetStateSize(element.UndoSet);
+    }
+    while (totalSize > this->MemoryLimit && undoStack.size() > 1)
+    {
+      totalSize -= ::vtkGetUndoSetStateSize(undoStack.front().UndoSet);
+      undoStack.erase(undoStack.begin());
+      this->InvokeEvent(vtkUndoStack::UndoSetRemovedEvent);
+    }
+  }
+
+  // A coalesced changeSet is not on the stack, the set it was merged into was
+  // already announced when it was pushed.
+  if (!coalesced)
+  {
+    this->InvokeEvent(PushUndoSetEvent, changeSet);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void vtkSMUndoStack::BeginCoalescing()
+{
+  if (this->CoalescingCount++ == 0)
+  {
+    this->Internal->CoalescingTarget = nullptr;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void vtkSMUndoStack::EndCoalescing()
+{
+  if (this->CoalescingCount == 0)
+  {
+    vtkWarningMacro("EndCoalescing called without a BeginCoalescing.");
+    return;
+  }
+  if (--this->CoalescingCount == 0)
+  {
+    this->Internal->CoalescingTarget = nullptr;
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool vtkSMUndoStack::CoalesceWithTop(const char* label, vtkUndoSet* changeSet)
+{
+  auto& undoStack = this->vtkUndoStack::Internal->UndoStack;
+  if (this->CoalescingCount == 0 || !this->Internal->CoalescingTarget || !label ||
+    undoStack.empty() || undoStack.back().Label != label)
+  {
+    return false;
+  }
+
+  vtkUndoSet* topSet = undoStack.back().UndoSet;
+  if (topSet != this->Internal->CoalescingTarget.GetPointer())
+  {
+    return false;
+  }
+
+  vtkSMRemoteObjectUpdateUndoElement* top = ::vtkGetSingleUpdateElement(topSet);
+  vtkSMRemoteObjectUpdateUndoElement* next = ::vtkGetSingleUpdateElement(changeSet);
+  if (!top || !next || top->GetSession() != next->GetSession() ||
+    top->GetGlobalId() != next->GetGlobalId() ||
+    top->AfterState->SerializeAsString() != next->BeforeState->SerializeAsString())
+  {
+    return false;
+  }
+
+  top->AfterState->CopyFrom(*next->AfterState);
+  return true;
 }
 
 //-----------------------------------------------------------------------------
@@ -154,6 +274,9 @@ int vtkSMUndoStack::Undo()
     return 0;
   }
 
+  // Changes pushed after an undo start a new undo set.
+  this->Internal->CoalescingTarget = nullptr;
+
   // Hold remote objects refs while the UndoSet is processing
   vtkNew<vtkCollection> remoteObjectsCollection;
   this->FillWithRemoteObjects(this->GetNextUndoSet(), remoteObjectsCollection.GetPointer());
@@ -174,6 +297,9 @@ int vtkSMUndoStack::Redo()
     return 0;
   }
 
+  // Changes pushed after a redo start a new undo set.
+  this->Internal->CoalescingTarget = nullptr;
+
   // Hold remote objects refs while the UndoSet is processing
   vtkNew<vtkCollection> remoteObjectsCollection;
   this->FillWithRemoteObjects(this->GetNextRedoSet(), remoteObjectsCollection.GetPointer());
@@ -199,4 +325,6 @@ void vtkSMUndoStack::FillWithRemoteObjects(vtkUndoSet* undoSet, vtkCollection* c
 void vtkSMUndoStack::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "MemoryLimit: " << this->MemoryLimit << endl;
+  os << indent << "Coalescing: " << this->GetCoalescing() << endl;
 }
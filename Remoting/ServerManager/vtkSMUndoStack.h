@@ -54,9 +54,28 @@ public:
   /**
    * Push an undo set on the Undo stack. This will clear
    * any sets in the Redo stack.
+   * Within a coalescing scope (see BeginCoalescing()), when the set on the top
+   * of the undo stack was pushed in the same scope, and both it and changeSet
+   * have the given label and only update the same proxy, one after the other,
+   * changeSet is merged into it instead. The merged set restores the state
+   * before the first change and redoes the last one. PushUndoSetEvent is not
+   * fired for a merged changeSet.
    */
   void Push(const char* label, vtkUndoSet* changeSet) override;
 
+  ///@{
+  /**
+   * Begin/end a coalescing scope, e.g. for the duration of a mouse drag, so
+   * that the successive changes it makes to a proxy are undone in a single
+   * step. Scopes may be nested, the scope ends with the outermost
+   * EndCoalescing(). Undo sets pushed outside of a scope, or before
+   * an Undo() or Redo(), are never merged.
+   */
+  void BeginCoalescing();
+  void EndCoalescing();
+  bool GetCoalescing() const { return this->CoalescingCount > 0; }
+  ///@}
+
   /**
    * Performs an Undo using the set on the top of the undo stack. The set is poped from
    * the undo stack and pushed at the top of the redo stack.
@@ -75,6 +94,18 @@ public:
    */
   int Redo() override;
 
+  ///@{
+  /**
+   * Approximate limit, in bytes, on the size of the proxy states held by the
+   * undo sets on the undo stack. When a push exceeds it, the oldest undo sets
+   * are removed, but the most recent one is always kept. This complements
+   * StackDepth for undo sets with large states. 0 means no limit.
+   * Default is 64 MiB.
+   */
+  vtkSetClampMacro(MemoryLimit, vtkIdType, 0, VTK_ID_MAX);
+  vtkGetMacro(MemoryLimit, vtkIdType);
+  ///@}
+
   enum EventIds
   {
     PushUndoSetEvent = 1987,
@@ -95,6 +126,13 @@ protected:
   // is supposed to happen.
   void FillWithRemoteObjects(vtkUndoSet* undoSet, vtkCollection* collection);
 
+  // Merges changeSet into the set on the top of the undo stack when they can
+  // be coalesced, as described in Push(). Returns true on success.
+  bool CoalesceWithTop(const char* label, vtkUndoSet* changeSet);
+
+  vtkIdType MemoryLimit;
+  int CoalescingCount;
+
 private:
   vtkSMUndoStack(const vtkSMUndoStack&) = delete;
   void operator=(const vtkSMUndoStack&) = delete;
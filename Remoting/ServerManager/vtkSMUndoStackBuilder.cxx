@@ -122,7 +122,7 @@ bool vtkSMUndoStackBuilder::Add(vtkUndoElement* element)
   return true;
 }
 //-----------------------------------------------------------------------------
-void vtkSMUndoStackBuilder::OnStateChange(vtkSMSession* session, vtkTypeUInt32 vtkNotUsed(globalId),
+void vtkSMUndoStackBuilder::OnStateChange(vtkSMSession* session, vtkTypeUInt32 globalId,
   const vtkSMMessage* previousState, const vtkSMMessage* newState)
 {
   if (this->IgnoreAllChanges || !this->HandleChangeEvents() || !this->UndoStack ||
@@ -131,6 +131,21 @@ void vtkSMUndoStackBuilder::OnStateChange(vtkSMSession* session, vtkTypeUInt32 v
     return;
   }
 
+  // Successive changes to the same object in an undo set, e.g. when a property
+  // is modified several times while interacting with a widget, only need the
+  // state before the first change and the state after the last one.
+  const int numElements = this->UndoSet->GetNumberOfElements();
+  vtkSMRemoteObjectUpdateUndoElement* lastElement = numElements > 0
+    ? vtkSMRemoteObjectUpdateUndoElement::SafeDownCast(this->UndoSet->GetElement(numElements - 1))
+    : nullptr;
+  if (lastElement && lastElement->GetSession() == session &&
+    lastElement->GetGlobalId() == globalId && previousState && newState &&
+    lastElement->AfterState->SerializeAsString() == previousState->SerializeAsString())
+  {
+    lastElement->AfterState->CopyFrom(*newState);
+    return;
+  }
+
   vtkSMRemoteObjectUpdateUndoElement* undoElement;
   undoElement = vtkSMRemoteObjectUpdateUndoElement::New();
   undoElement->SetSession(session);
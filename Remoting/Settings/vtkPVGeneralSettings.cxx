@@ -18,6 +18,7 @@
 #include "vtkAlgorithm.h"
 #include "vtkLegacy.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVCompositeDataPipeline.h"
 #include "vtkProcessModule.h"
 #include "vtkSISourceProxy.h"
 #include "vtkSMArraySelectionDomain.h"
@@ -36,6 +37,10 @@
 #include "vtkSMTransferFunctionManager.h"
 #endif
 
+#if VTK_MODULE_ENABLE_ParaView_VTKExtensionsIOCore
+#include "vtkFileSeriesReader.h"
+#endif
+
 #if VTK_MODULE_ENABLE_VTK_AcceleratorsVTKmFilters
 #include "vtkmFilterOverrides.h"
 #endif
@@ -283,6 +288,46 @@ bool vtkPVGeneralSettings::GetUseAcceleratedFilters()
 #endif
 }
 
+//----------------------------------------------------------------------------
+void vtkPVGeneralSettings::SetNumberOfFilesToPrefetch(int val)
+{
+  static_cast<void>(val);
+
+#if VTK_MODULE_ENABLE_ParaView_VTKExtensionsIOCore
+  if (this->GetNumberOfFilesToPrefetch() != val)
+  {
+    vtkFileSeriesReader::SetNumberOfFilesToPrefetch(val);
+    this->Modified();
+  }
+#endif
+}
+
+//----------------------------------------------------------------------------
+int vtkPVGeneralSettings::GetNumberOfFilesToPrefetch()
+{
+#if VTK_MODULE_ENABLE_ParaView_VTKExtensionsIOCore
+  return vtkFileSeriesReader::GetNumberOfFilesToPrefetch();
+#else
+  return 0;
+#endif
+}
+
+//----------------------------------------------------------------------------
+void vtkPVGeneralSettings::SetTemporalCacheMemoryBudget(int val)
+{
+  if (this->GetTemporalCacheMemoryBudget() != val)
+  {
+    vtkPVCompositeDataPipeline::SetTemporalCacheMemoryBudget(static_cast<vtkTypeInt64>(val) * 1024);
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+int vtkPVGeneralSettings::GetTemporalCacheMemoryBudget()
+{
+  return static_cast<int>(vtkPVCompositeDataPipeline::GetTemporalCacheMemoryBudget() / 1024);
+}
+
 //----------------------------------------------------------------------------
 void vtkPVGeneralSettings::PrintSelf(ostream& os, vtkIndent indent)
 {
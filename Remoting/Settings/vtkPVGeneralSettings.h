@@ -318,6 +318,26 @@ public:
   vtkBooleanMacro(UseAcceleratedFilters, bool);
   ///@}
 
+  ///@{
+  /**
+   * Number of files file-series readers prefetch in the background for the
+   * timesteps expected to be requested next.
+   * Forwards the call to vtkFileSeriesReader::SetNumberOfFilesToPrefetch.
+   */
+  void SetNumberOfFilesToPrefetch(int);
+  int GetNumberOfFilesToPrefetch();
+  ///@}
+
+  ///@{
+  /**
+   * Memory budget, in MiB, for the temporal cache of pipeline outputs shared by
+   * all filters. 0 disables the cache.
+   * Forwards the call to vtkPVCompositeDataPipeline::SetTemporalCacheMemoryBudget.
+   */
+  void SetTemporalCacheMemoryBudget(int);
+  int GetTemporalCacheMemoryBudget();
+  ///@}
+
   ///@{
   /**
    * ActiveSelection is hooked up in the MultiBlock Inspector such that a click on a/multiple
@@ -484,18 +484,23 @@ void vtkSMViewProxy::Update()
     this->ExecuteStream(stream);
     this->GetSession()->CleanupPendingProgress();
 
-    unsigned int numProducers = this->GetNumberOfProducers();
-    for (unsigned int i = 0; i < numProducers; i++)
     {
-      vtkSMRepresentationProxy* repr =
-        vtkSMRepresentationProxy::SafeDownCast(this->GetProducerProxy(i));
-      if (repr)
+      // Update domains depending on the representations' inputs once, after
+      // all representations have been notified.
+      vtkSMProxyProperty::DeferDomainUpdates deferDomainUpdates;
+      unsigned int numProducers = this->GetNumberOfProducers();
+      for (unsigned int i = 0; i < numProducers; i++)
       {
-        repr->ViewUpdated(this);
-      }
-      else
-      {
-        this->GetProducerProxy(i)->PostUpdateData(false);
+        vtkSMRepresentationProxy* repr =
+          vtkSMRepresentationProxy::SafeDownCast(this->GetProducerProxy(i));
+        if (repr)
+        {
+          repr->ViewUpdated(this);
+        }
+        else
+        {
+          this->GetProducerProxy(i)->PostUpdateData(false);
+        }
       }
     }
 
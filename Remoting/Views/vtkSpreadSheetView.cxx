@@ -588,6 +588,7 @@ vtkSpreadSheetView::vtkSpreadSheetView()
 {
   this->ReductionFilter->SetController(vtkMultiProcessController::GetGlobalController());
   this->ReductionFilter->SetPostGatherHelper(vtkNew<SpreadSheetViewMergeTables>().GetPointer());
+  this->ReductionFilter->SetTreeReductionFanIn(vtkReductionFilter::DEFAULT_TREE_REDUCTION_FAN_IN);
   this->DeliveryFilter->SetOutputDataType(VTK_TABLE);
   this->ReductionFilter->SetInputConnection(this->TableStreamer->GetOutputPort());
 
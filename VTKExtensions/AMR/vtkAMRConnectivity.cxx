@@ -245,7 +245,14 @@ vtkAMRConnectivity::vtkAMRConnectivity()
   this->PropagateGhosts = 0;
 }
 
-vtkAMRConnectivity::~vtkAMRConnectivity() = default;
+vtkAMRConnectivity::~vtkAMRConnectivity()
+{
+  if (this->Helper)
+  {
+    this->Helper->Delete();
+    this->Helper = nullptr;
+  }
+}
 
 void vtkAMRConnectivity::PrintSelf(ostream& os, vtkIndent indent)
 {
@@ -309,7 +316,12 @@ int vtkAMRConnectivity::RequestData(vtkInformation* vtkNotUsed(request),
 
   amrOutput->ShallowCopy(amrInput);
 
-  this->Helper = vtkAMRDualGridHelper::New();
+  // The helper is kept between requests so that it can reuse the block
+  // topology when the AMR structure does not change.
+  if (this->Helper == nullptr)
+  {
+    this->Helper = vtkAMRDualGridHelper::New();
+  }
   vtkMultiProcessController* controller = vtkMultiProcessController::GetGlobalController();
   this->Helper->SetController(controller);
   this->Helper->Initialize(amrInput);
@@ -319,10 +331,19 @@ int vtkAMRConnectivity::RequestData(vtkInformation* vtkNotUsed(request),
   {
     if (this->DoRequestData(amrOutput, this->VolumeArrays[i].c_str()) == 0)
     {
+      // The state of the helper is unknown, do not reuse it.
+      this->Helper->Delete();
+      this->Helper = nullptr;
       return 0;
     }
   }
-  this->Helper->Delete();
+
+  if (noOfArrays > 1)
+  {
+    // The data is set up for the last array only, the next request starts
+    // over from the first one. Only keep the block topology.
+    this->Helper->ReleaseData();
+  }
 
   return 1;
 }
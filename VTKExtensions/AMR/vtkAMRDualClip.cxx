@@ -1050,6 +1050,11 @@ vtkAMRDualClip::~vtkAMRDualClip()
     delete this->BlockLocator;
     this->BlockLocator = nullptr;
   }
+  if (this->Helper)
+  {
+    this->Helper->Delete();
+    this->Helper = nullptr;
+  }
   this->SetController(nullptr);
 }
 
@@ -1157,12 +1162,12 @@ vtkMultiBlockDataSet* vtkAMRDualClip::DoRequestData(
 
   mpds->SetNumberOfPieces(0);
 
-  if (this->Helper)
+  // The helper is kept between requests so that it can reuse the block
+  // topology.
+  if (this->Helper == nullptr)
   {
-    this->Helper->Delete();
+    this->Helper = vtkAMRDualGridHelper::New();
   }
-
-  this->Helper = vtkAMRDualGridHelper::New();
   this->Helper->SetEnableDegenerateCells(this->EnableDegenerateCells);
   if (this->EnableMultiProcessCommunication)
   {
@@ -1231,8 +1236,9 @@ vtkMultiBlockDataSet* vtkAMRDualClip::DoRequestData(
   this->Cells = nullptr;
 
   mpds->Delete();
-  this->Helper->Delete();
-  this->Helper = nullptr;
+  // Sharing the level masks writes into the block images, they cannot be
+  // reused by the next request. Only keep the block topology.
+  this->Helper->ReleaseData();
 
   return mbdsOutput0;
 }
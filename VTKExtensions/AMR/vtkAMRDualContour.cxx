@@ -645,6 +645,11 @@ vtkAMRDualContour::~vtkAMRDualContour()
     delete this->BlockLocator;
     this->BlockLocator = nullptr;
   }
+  if (this->Helper)
+  {
+    this->Helper->Delete();
+    this->Helper = nullptr;
+  }
   this->SetController(nullptr);
 }
 
@@ -747,6 +752,9 @@ int vtkAMRDualContour::RequestData(vtkInformation* vtkNotUsed(request),
   }
   else
   {
+    // The state of the helper is unknown, do not reuse it.
+    this->Helper->Delete();
+    this->Helper = nullptr;
     return 0;
   }
 
@@ -755,12 +763,12 @@ int vtkAMRDualContour::RequestData(vtkInformation* vtkNotUsed(request),
 
 void vtkAMRDualContour::InitializeRequest(vtkNonOverlappingAMR* hbdsInput)
 {
-  if (this->Helper)
+  // The helper is kept between requests so that it can reuse the block
+  // topology and, when only the isovalue changed, the prepared data.
+  if (this->Helper == nullptr)
   {
-    this->Helper->Delete();
+    this->Helper = vtkAMRDualGridHelper::New();
   }
-
-  this->Helper = vtkAMRDualGridHelper::New();
   this->Helper->SetEnableDegenerateCells(this->EnableDegenerateCells);
   this->Helper->SetSkipGhostCopy(this->SkipGhostCopy);
   if (this->EnableMultiProcessCommunication)
@@ -776,8 +784,7 @@ void vtkAMRDualContour::InitializeRequest(vtkNonOverlappingAMR* hbdsInput)
 
 void vtkAMRDualContour::FinalizeRequest()
 {
-  this->Helper->Delete();
-  this->Helper = nullptr;
+  // The helper is kept for the next request.
 }
 
 vtkMultiBlockDataSet* vtkAMRDualContour::DoRequestData(
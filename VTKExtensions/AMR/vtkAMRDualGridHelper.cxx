@@ -33,6 +33,8 @@
 #include "vtkSmartPointer.h"
 #define VTK_CREATE(type, name) vtkSmartPointer<type> name = vtkSmartPointer<type>::New()
 
+#include <algorithm>
+#include <cstring>
 #include <list>
 #include <vector>
 
@@ -439,6 +441,20 @@ vtkAMRDualGridHelperBlock::~vtkAMRDualGridHelperBlock()
   }
 }
 //----------------------------------------------------------------------------
+void vtkAMRDualGridHelperBlock::ResetImage(vtkImageData* image)
+{
+  if (this->Image == image)
+  {
+    return;
+  }
+  if (this->Image && this->CopyFlag)
+  { // We made a copy of the image and have to delete it.
+    this->Image->Delete();
+  }
+  this->Image = image;
+  this->CopyFlag = 0;
+}
+//----------------------------------------------------------------------------
 void vtkAMRDualGridHelperBlock::ResetRegionBits()
 {
 
@@ -720,6 +736,12 @@ vtkAMRDualGridHelper::vtkAMRDualGridHelper()
   this->EnableDegenerateCells = 1;
   this->EnableAsynchronousCommunication = 1;
   this->NumberOfBlocksInThisProcess = 0;
+  this->InitializeController = nullptr;
+  this->DataIsSetup = false;
+  this->SetupInput = nullptr;
+  this->SetupDataMTime = 0;
+  this->SetupEnableDegenerateCells = 1;
+  this->SetupSkipGhostCopy = 0;
   for (ii = 0; ii < 3; ++ii)
   {
     this->StandardBlockDimensions[ii] = 0;
@@ -739,25 +761,35 @@ vtkAMRDualGridHelper::vtkAMRDualGridHelper()
 }
 //----------------------------------------------------------------------------
 vtkAMRDualGridHelper::~vtkAMRDualGridHelper()
+{
+  this->SetArrayName(nullptr);
+
+  this->ClearLevels();
+
+  this->Controller->UnRegister(this);
+  this->Controller = nullptr;
+}
+//----------------------------------------------------------------------------
+void vtkAMRDualGridHelper::ClearLevels()
 {
   int ii;
   int numberOfLevels = (int)(this->Levels.size());
 
-  this->SetArrayName(nullptr);
-
   for (ii = 0; ii < numberOfLevels; ++ii)
   {
     delete this->Levels[ii];
     this->Levels[ii] = nullptr;
   }
+  this->Levels.clear();
 
   // Todo: See if we really need this.
   this->NumberOfBlocksInThisProcess = 0;
 
   this->DegenerateRegionQueue.clear();
 
-  this->Controller->UnRegister(this);
-  this->Controller = nullptr;
+  this->StructureKey.clear();
+  this->InitializeController = nullptr;
+  this->DataIsSetup = false;
 }
 //----------------------------------------------------------------------------
 void vtkAMRDualGridHelper::PrintSelf(ostream& os, vtkIndent indent)
@@ -852,6 +884,9 @@ void vtkAMRDualGridHelper::AddBlock(int level, int id, vtkImageData* volume)
   int y = (int)((center[1] - this->GlobalOrigin[1]) / blockSize[1]);
   int z = (int)((center[2] - this->GlobalOrigin[2]) / blockSize[2]);
   vtkAMRDualGridHelperBlock* block = this->Levels[level]->AddGridBlock(x, y, z, id, volume);
+  // When the topology is reused the block still references the image of
+  // the previous input.
+  block->ResetImage(volume);
 
   // We need to set this ivar here because we need to compute the index
   // from the global origin and root spacing.  The issue is that some blocks
@@ -2243,6 +2278,119 @@ void vtkAMRDualGridHelper::FinishDegenerateRegionsCommMPIAsynchronous(bool hackL
 // The array name is the cell array that is being processed by the filter.
 // Ghost values have to be modified at level changes.  It could be extended to
 // process multiple arrays.
+//----------------------------------------------------------------------------
+// Everything the block topology built by Initialize depends on: the
+// boxes of the local blocks and the meta information passed by a
+// coprocessing adaptor.
+static void vtkAMRDualGridHelperComputeStructureKey(
+  vtkNonOverlappingAMR* input, std::vector<double>& key)
+{
+  key.clear();
+  int numLevels = input->GetNumberOfLevels();
+  key.push_back(numLevels);
+  for (int level = 0; level < numLevels; ++level)
+  {
+    int numBlocks = input->GetNumberOfDataSets(level);
+    key.push_back(numBlocks);
+    for (int blockId = 0; blockId < numBlocks; ++blockId)
+    {
+      vtkImageData* image = input->GetDataSet(level, blockId);
+      if (image == nullptr)
+      {
+        key.push_back(0);
+        continue;
+      }
+      key.push_back(1);
+      int* ext = image->GetExtent();
+      key.insert(key.end(), ext, ext + 6);
+      double* origin = image->GetOrigin();
+      key.insert(key.end(), origin, origin + 3);
+      double* spacing = image->GetSpacing();
+      key.insert(key.end(), spacing, spacing + 3);
+    }
+  }
+
+  vtkFieldData* inputFd = input->GetFieldData();
+  const char* metaArrayNames[] = { "GlobalBounds", "GlobalBoxSize", "MinLevel", "MinLevelSpacing",
+    "Neighbors" };
+  for (const char* name : metaArrayNames)
+  {
+    vtkDataArray* da = inputFd->GetArray(name);
+    vtkIdType numValues = da ? da->GetNumberOfValues() : -1;
+    key.push_back(static_cast<double>(numValues));
+    for (vtkIdType ii = 0; ii < numValues; ++ii)
+    {
+      key.push_back(da->GetVariantValue(ii).ToDouble());
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// The arrays of the blocks can be modified in place, e.g. by a Catalyst
+// adaptor, without modifying the AMR dataset itself.
+static vtkMTimeType vtkAMRDualGridHelperComputeDataMTime(vtkNonOverlappingAMR* input)
+{
+  vtkMTimeType mtime = input->GetMTime();
+  int numLevels = input->GetNumberOfLevels();
+  for (int level = 0; level < numLevels; ++level)
+  {
+    int numBlocks = input->GetNumberOfDataSets(level);
+    for (int blockId = 0; blockId < numBlocks; ++blockId)
+    {
+      vtkImageData* image = input->GetDataSet(level, blockId);
+      if (image == nullptr)
+      {
+        continue;
+      }
+      mtime = std::max(mtime, image->GetMTime());
+      vtkCellData* cellData = image->GetCellData();
+      for (int ii = 0; ii < cellData->GetNumberOfArrays(); ++ii)
+      {
+        vtkAbstractArray* array = cellData->GetAbstractArray(ii);
+        mtime = array ? std::max(mtime, array->GetMTime()) : mtime;
+      }
+    }
+  }
+  return mtime;
+}
+
+//----------------------------------------------------------------------------
+void vtkAMRDualGridHelper::ReleaseData()
+{
+  for (int level = 0; level < this->GetNumberOfLevels(); ++level)
+  {
+    int numBlocks = this->GetNumberOfBlocksInLevel(level);
+    for (int blockId = 0; blockId < numBlocks; ++blockId)
+    {
+      this->GetBlock(level, blockId)->ResetImage(nullptr);
+    }
+  }
+  this->DataIsSetup = false;
+  this->SetupInput = nullptr;
+  this->SetupDataMTime = 0;
+}
+
+//----------------------------------------------------------------------------
+void vtkAMRDualGridHelper::RebindBlocks(vtkNonOverlappingAMR* input)
+{
+  int numLevels = input->GetNumberOfLevels();
+  for (int level = 0; level < numLevels; ++level)
+  {
+    int numBlocks = input->GetNumberOfDataSets(level);
+    for (int blockId = 0; blockId < numBlocks; ++blockId)
+    {
+      vtkImageData* image = input->GetDataSet(level, blockId);
+      if (image)
+      {
+        // The grid location is found again and the ghost levels
+        // stripped by the reader are added back.
+        this->AddBlock(level, blockId, image);
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
 int vtkAMRDualGridHelper::Initialize(vtkNonOverlappingAMR* input)
 {
   vtkTimerLogSmartMarkEvent markevent("vtkAMRDualGridHelper::Initialize", this->Controller);
@@ -2250,6 +2398,30 @@ int vtkAMRDualGridHelper::Initialize(vtkNonOverlappingAMR* input)
   int blockId, numBlocks;
   int numLevels = input->GetNumberOfLevels();
 
+  // Keep the topology of the previous call if the structure of the input
+  // did not change (e.g. a new isovalue or a new timestep of a fixed
+  // hierarchy).  All processes have to agree since building it communicates.
+  std::vector<double> structureKey;
+  vtkAMRDualGridHelperComputeStructureKey(input, structureKey);
+  int reuse = !this->Levels.empty() && this->InitializeController == this->Controller &&
+    structureKey == this->StructureKey;
+  if (this->Controller->GetNumberOfProcesses() > 1)
+  {
+    int localReuse = reuse;
+    this->Controller->AllReduce(&localReuse, &reuse, 1, vtkCommunicator::MIN_OP);
+  }
+  if (reuse)
+  {
+    if (!this->DataIsSetup || input != this->SetupInput ||
+      vtkAMRDualGridHelperComputeDataMTime(input) != this->SetupDataMTime)
+    {
+      this->RebindBlocks(input);
+      this->DataIsSetup = false;
+    }
+    return VTK_OK;
+  }
+  this->ClearLevels();
+
   // Create the level objects.
   this->Levels.reserve(numLevels);
   for (int ii = 0; ii < numLevels; ++ii)
@@ -2325,6 +2497,9 @@ int vtkAMRDualGridHelper::Initialize(vtkNonOverlappingAMR* input)
     // All processes will have all blocks (but not image data).
     this->ShareBlocks();
   }
+
+  this->StructureKey.swap(structureKey);
+  this->InitializeController = this->Controller;
   return VTK_OK;
 }
 
@@ -2335,6 +2510,41 @@ int vtkAMRDualGridHelper::SetupData(vtkNonOverlappingAMR* input, const char* arr
   int blockId, numBlocks;
   int numLevels = input->GetNumberOfLevels();
 
+  // Nothing to do if the blocks are already set up for this data, array
+  // and options.  All processes have to agree since the setup communicates.
+  int reuse = this->DataIsSetup && input == this->SetupInput &&
+    vtkAMRDualGridHelperComputeDataMTime(input) == this->SetupDataMTime && this->ArrayName &&
+    arrayName &&
+    strcmp(this->ArrayName, arrayName) == 0 &&
+    this->EnableDegenerateCells == this->SetupEnableDegenerateCells &&
+    this->SkipGhostCopy == this->SetupSkipGhostCopy;
+  if (this->Controller->GetNumberOfProcesses() > 1)
+  {
+    int localReuse = reuse;
+    this->Controller->AllReduce(&localReuse, &reuse, 1, vtkCommunicator::MIN_OP);
+  }
+  if (reuse)
+  {
+    // Algorithms use the center region bit to mark blocks they have
+    // processed.  It is not used otherwise, so restore it.
+    for (int level = 0; level < this->GetNumberOfLevels(); ++level)
+    {
+      numBlocks = this->GetNumberOfBlocksInLevel(level);
+      for (blockId = 0; blockId < numBlocks; ++blockId)
+      {
+        this->GetBlock(level, blockId)->RegionBits[1][1][1] = vtkAMRRegionBitOwner;
+      }
+    }
+    return VTK_OK;
+  }
+  if (this->DataIsSetup)
+  {
+    // The images of the blocks were modified for another array, start
+    // over from the input.
+    this->RebindBlocks(input);
+    this->DataIsSetup = false;
+  }
+
   vtkDualGridHelperCheckAssumption = 1;
   this->SetArrayName(arrayName);
 
@@ -2383,6 +2593,12 @@ int vtkAMRDualGridHelper::SetupData(vtkNonOverlappingAMR* input, const char* arr
   // Setup faces for seeding connectivity between blocks.
   // this->CreateFaces();
 
+  this->DataIsSetup = true;
+  this->SetupInput = input;
+  this->SetupDataMTime = vtkAMRDualGridHelperComputeDataMTime(input);
+  this->SetupEnableDegenerateCells = this->EnableDegenerateCells;
+  this->SetupSkipGhostCopy = this->SkipGhostCopy;
+
   return VTK_OK;
 }
 void vtkAMRDualGridHelper::ClearRegionRemoteCopyQueue()
@@ -23,6 +23,14 @@
  * This class will take advantage of some meta information, if available
  * from a coprocessing adaptor.  If not available, it will compute the
  * information.
+ *
+ * A helper can be kept across executions.  Initialize() keeps the block
+ * topology (levels, neighbor grid and remote blocks) of the previous call
+ * when the AMR structure of the input has not changed and only rebinds the
+ * local images, and SetupData() is skipped when it is called again with the
+ * same input data, array and options.  The input data is considered the same
+ * when neither the AMR dataset, its blocks nor their cell arrays have been
+ * modified.
  */
 
 #ifndef vtkAMRDualGridHelper_h
@@ -96,6 +104,21 @@ public:
 
   int Initialize(vtkNonOverlappingAMR* input);
   int SetupData(vtkNonOverlappingAMR* input, const char* arrayName);
+
+  /**
+   * Forces the next SetupData() call to start over from the input images.
+   * Call this after modifying the block images set up by SetupData().
+   */
+  void InvalidateData() { this->DataIsSetup = false; }
+
+  /**
+   * Releases the block images set up by SetupData(), including the copies
+   * made for ghost values, while keeping the block topology for the next
+   * Initialize(). Call this when the data cannot be reused by the next
+   * request.
+   */
+  void ReleaseData();
+
   const double* GetGlobalOrigin() { return this->GlobalOrigin; }
   const double* GetRootSpacing() { return this->RootSpacing; }
   int GetNumberOfBlocks() { return this->NumberOfBlocksInThisProcess; }
@@ -163,6 +186,17 @@ private:
   void ComputeGlobalMetaData(vtkNonOverlappingAMR* input);
   void AddBlock(int level, int id, vtkImageData* volume);
 
+  // Reuse of the topology and data between calls.
+  void ClearLevels();
+  void RebindBlocks(vtkNonOverlappingAMR* input);
+  std::vector<double> StructureKey;
+  vtkMultiProcessController* InitializeController;
+  bool DataIsSetup;
+  vtkNonOverlappingAMR* SetupInput;
+  vtkMTimeType SetupDataMTime;
+  int SetupEnableDegenerateCells;
+  int SetupSkipGhostCopy;
+
   // Manage connectivity seeds between blocks.
   void CreateFaces();
   void FindExistingFaces(vtkAMRDualGridHelperBlock* block, int level, int x, int y, int z);
@@ -241,6 +275,8 @@ public:
   ~vtkAMRDualGridHelperBlock();
 
   void ResetRegionBits();
+  // Points the block to an image, releasing the copy of the previous image.
+  void ResetImage(vtkImageData* image);
   // We assume that all blocks have ghost levels and are the same
   // dimension.  The vtk spy reader strips the ghost cells on
   // boundary blocks (on the outer surface of the data set).
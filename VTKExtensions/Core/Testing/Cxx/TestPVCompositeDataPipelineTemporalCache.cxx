@@ -0,0 +1,214 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestPVCompositeDataPipelineTemporalCache.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include <vtkDoubleArray.h>
+#include <vtkInformation.h>
+#include <vtkInformationVector.h>
+#include <vtkLogger.h>
+#include <vtkNew.h>
+#include <vtkObjectFactory.h>
+#include <vtkPVCompositeDataPipeline.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkPolyDataAlgorithm.h>
+#include <vtkStreamingDemandDrivenPipeline.h>
+
+namespace
+{
+// Produces a polydata whose number of points and point values depend on the
+// requested time.
+class vtkTestTemporalSource : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkTestTemporalSource* New();
+  vtkTypeMacro(vtkTestTemporalSource, vtkPolyDataAlgorithm);
+
+  int Executions = 0;
+
+protected:
+  vtkTestTemporalSource() { this->SetNumberOfInputPorts(0); }
+
+  int RequestInformation(vtkInformation*, vtkInformationVector**, vtkInformationVector* outVec)
+    override
+  {
+    const double times[] = { 0.0, 1.0, 2.0, 3.0 };
+    const double range[] = { 0.0, 3.0 };
+    vtkInformation* outInfo = outVec->GetInformationObject(0);
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_STEPS(), times, 4);
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_RANGE(), range, 2);
+    return 1;
+  }
+
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector* outVec) override
+  {
+    ++this->Executions;
+    vtkInformation* outInfo = outVec->GetInformationObject(0);
+    const double time = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP());
+    const int numPoints = 10 + static_cast<int>(time);
+
+    vtkNew<vtkPoints> points;
+    vtkNew<vtkDoubleArray> values;
+    values->SetName("values");
+    for (int cc = 0; cc < numPoints; ++cc)
+    {
+      points->InsertNextPoint(cc, time, 0.0);
+      values->InsertNextValue(cc * time);
+    }
+    vtkPolyData* output = vtkPolyData::GetData(outInfo);
+    output->SetPoints(points);
+    output->GetPointData()->AddArray(values);
+    output->GetInformation()->Set(vtkDataObject::DATA_TIME_STEP(), time);
+    return 1;
+  }
+};
+vtkStandardNewMacro(vtkTestTemporalSource);
+
+// Scales the point values of its input into a new array.
+class vtkTestScaleFilter : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkTestScaleFilter* New();
+  vtkTypeMacro(vtkTestScaleFilter, vtkPolyDataAlgorithm);
+
+  int Executions = 0;
+
+protected:
+  int RequestData(vtkInformation*, vtkInformationVector** inVec, vtkInformationVector* outVec)
+    override
+  {
+    ++this->Executions;
+    vtkPolyData* input = vtkPolyData::GetData(inVec[0], 0);
+    vtkPolyData* output = vtkPolyData::GetData(outVec, 0);
+    output->ShallowCopy(input);
+
+    vtkDataArray* values = input->GetPointData()->GetArray("values");
+    vtkNew<vtkDoubleArray> scaled;
+    scaled->SetName("scaled");
+    scaled->SetNumberOfTuples(values->GetNumberOfTuples());
+    for (vtkIdType cc = 0; cc < values->GetNumberOfTuples(); ++cc)
+    {
+      scaled->SetValue(cc, 2.0 * values->GetTuple1(cc));
+    }
+    output->GetPointData()->AddArray(scaled);
+    return 1;
+  }
+};
+vtkStandardNewMacro(vtkTestScaleFilter);
+
+struct Pipeline
+{
+  vtkNew<vtkTestTemporalSource> Source;
+  vtkNew<vtkTestScaleFilter> Filter;
+
+  Pipeline(bool allowCache)
+  {
+    vtkNew<vtkPVCompositeDataPipeline> sourceExecutive;
+    vtkNew<vtkPVCompositeDataPipeline> filterExecutive;
+    this->Source->SetExecutive(sourceExecutive);
+    this->Filter->SetExecutive(filterExecutive);
+    this->Filter->SetInputConnection(this->Source->GetOutputPort());
+    if (allowCache)
+    {
+      this->Filter->GetInformation()->Set(vtkPVCompositeDataPipeline::ALLOW_TEMPORAL_CACHE(), 1);
+    }
+  }
+
+  vtkPolyData* Update(double time)
+  {
+    this->Filter->UpdateTimeStep(time);
+    return vtkPolyData::SafeDownCast(this->Filter->GetOutputDataObject(0));
+  }
+};
+
+bool SameData(vtkPolyData* pd1, vtkPolyData* pd2)
+{
+  if (pd1->GetNumberOfPoints() != pd2->GetNumberOfPoints())
+  {
+    return false;
+  }
+  for (const char* name : { "values", "scaled" })
+  {
+    vtkDataArray* array1 = pd1->GetPointData()->GetArray(name);
+    vtkDataArray* array2 = pd2->GetPointData()->GetArray(name);
+    if (!array1 || !array2 || array1->GetNumberOfTuples() != array2->GetNumberOfTuples())
+    {
+      return false;
+    }
+    for (vtkIdType cc = 0; cc < array1->GetNumberOfTuples(); ++cc)
+    {
+      if (array1->GetTuple1(cc) != array2->GetTuple1(cc))
+      {
+        return false;
+      }
+    }
+  }
+  return pd1->GetInformation()->Get(vtkDataObject::DATA_TIME_STEP()) ==
+    pd2->GetInformation()->Get(vtkDataObject::DATA_TIME_STEP());
+}
+}
+
+#define TASSERT(x)                                                                                 \
+  if (!(x))                                                                                        \
+  {                                                                                                \
+    vtkLogF(ERROR, "failed at line %d: %s", __LINE__, #x);                                         \
+    vtkPVCompositeDataPipeline::SetTemporalCacheMemoryBudget(0);                                   \
+    return EXIT_FAILURE;                                                                           \
+  }
+
+int TestPVCompositeDataPipelineTemporalCache(int, char*[])
+{
+  vtkPVCompositeDataPipeline::SetTemporalCacheMemoryBudget(1024);
+
+  Pipeline cached(true);
+  Pipeline fresh(false);
+
+  for (double time : { 0.0, 1.0, 2.0 })
+  {
+    cached.Update(time);
+  }
+  TASSERT(cached.Filter->Executions == 3);
+  TASSERT(cached.Source->Executions == 3);
+  TASSERT(vtkPVCompositeDataPipeline::GetTemporalCacheMemoryUse() > 0);
+
+  // revisiting a timestep is served from the cache, without executing
+  // upstream, and matches a fresh execution.
+  vtkPolyData* hit = cached.Update(1.0);
+  TASSERT(cached.Filter->Executions == 3);
+  TASSERT(cached.Source->Executions == 3);
+  TASSERT(SameData(hit, fresh.Update(1.0)));
+  hit = cached.Update(0.0);
+  TASSERT(cached.Filter->Executions == 3);
+  TASSERT(SameData(hit, fresh.Update(0.0)));
+
+  // algorithms that did not opt in are never cached.
+  fresh.Update(1.0);
+  fresh.Update(0.0);
+  TASSERT(fresh.Filter->Executions == 4);
+  TASSERT(fresh.Source->Executions == 4);
+
+  // modifying the pipeline discards the cached outputs.
+  cached.Source->Modified();
+  hit = cached.Update(2.0);
+  TASSERT(cached.Filter->Executions == 4);
+  TASSERT(cached.Source->Executions == 4);
+  TASSERT(SameData(hit, fresh.Update(2.0)));
+
+  // disabling the cache releases it.
+  vtkPVCompositeDataPipeline::SetTemporalCacheMemoryBudget(0);
+  TASSERT(vtkPVCompositeDataPipeline::GetTemporalCacheMemoryUse() == 0);
+  cached.Update(1.0);
+  TASSERT(cached.Filter->Executions == 5);
+  return EXIT_SUCCESS;
+}
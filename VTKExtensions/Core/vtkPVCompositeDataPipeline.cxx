@@ -18,21 +18,318 @@ PURPOSE.  See the above copyright notice for more information.
 #include "vtkAlgorithmOutput.h"
 #include "vtkDataObject.h"
 #include "vtkInformation.h"
+#include "vtkInformationDoubleKey.h"
+#include "vtkInformationIntegerKey.h"
 #include "vtkInformationIntegerVectorKey.h"
 #include "vtkInformationKey.h"
 #include "vtkInformationObjectBaseKey.h"
 #include "vtkInformationVector.h"
+#include "vtkMultiProcessController.h"
 #include "vtkObjectFactory.h"
 #include "vtkPVPostFilterExecutive.h"
+#include "vtkSmartPointer.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <iterator>
+#include <list>
+#include <mutex>
+
+namespace
+{
+// Identifies what was requested from an output port. Two requests with the
+// same key on an unmodified pipeline produce the same output.
+struct vtkTemporalCacheKey
+{
+  double Time = 0.0;
+  int Piece = 0;
+  int NumberOfPieces = 1;
+  int GhostLevels = 0;
+  int Extent[6] = { 0, 0, 0, 0, 0, 0 };
+
+  bool operator==(const vtkTemporalCacheKey& other) const
+  {
+    return this->Time == other.Time && this->Piece == other.Piece &&
+      this->NumberOfPieces == other.NumberOfPieces && this->GhostLevels == other.GhostLevels &&
+      std::equal(this->Extent, this->Extent + 6, other.Extent);
+  }
+};
+
+class vtkTemporalCache
+{
+public:
+  struct Entry
+  {
+    vtkExecutive* Executive;
+    vtkTemporalCacheKey Key;
+    vtkMTimeType PipelineMTime;
+    double DataTime;
+    vtkSmartPointer<vtkDataObject> Data;
+    vtkTypeInt64 Size;
+  };
+
+  vtkTypeInt64 GetBudget()
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    return this->Budget;
+  }
+
+  void SetBudget(vtkTypeInt64 budget)
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    this->Budget = std::max<vtkTypeInt64>(budget, 0);
+    this->Trim();
+  }
+
+  vtkTypeInt64 GetUsed()
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    return this->Used;
+  }
+
+  // Returns the cached entry matching the request, if any, and marks it as the
+  // most recently used one. Entries generated by an older pipeline are dropped.
+  bool Find(vtkExecutive* exec, const vtkTemporalCacheKey& key, vtkMTimeType mtime, Entry& result)
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    for (auto iter = this->Entries.begin(); iter != this->Entries.end(); ++iter)
+    {
+      if (iter->Executive != exec || !(iter->Key == key))
+      {
+        continue;
+      }
+      if (iter->PipelineMTime != mtime)
+      {
+        this->Erase(iter);
+        return false;
+      }
+      this->Entries.splice(this->Entries.begin(), this->Entries, iter);
+      result = this->Entries.front();
+      return true;
+    }
+    return false;
+  }
+
+  void Add(vtkExecutive* exec, const vtkTemporalCacheKey& key, vtkMTimeType mtime,
+    double dataTime, vtkDataObject* data)
+  {
+    const vtkTypeInt64 size = static_cast<vtkTypeInt64>(data->GetActualMemorySize());
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    // outputs of the same executive generated by an older pipeline, or for the
+    // same request, are never going to be reused.
+    for (auto iter = this->Entries.begin(); iter != this->Entries.end();)
+    {
+      auto current = iter++;
+      if (current->Executive == exec && (current->PipelineMTime != mtime || current->Key == key))
+      {
+        this->Erase(current);
+      }
+    }
+    if (size > this->Budget)
+    {
+      return;
+    }
+    auto copy = vtkSmartPointer<vtkDataObject>::Take(data->NewInstance());
+    copy->ShallowCopy(data);
+    this->Entries.push_front(Entry{ exec, key, mtime, dataTime, copy, size });
+    this->Used += size;
+    this->Trim();
+  }
+
+  void Remove(vtkExecutive* exec)
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    for (auto iter = this->Entries.begin(); iter != this->Entries.end();)
+    {
+      auto current = iter++;
+      if (current->Executive == exec)
+      {
+        this->Erase(current);
+      }
+    }
+  }
+
+  void Clear()
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    this->Entries.clear();
+    this->Used = 0;
+  }
+
+private:
+  void Erase(std::list<Entry>::iterator iter)
+  {
+    this->Used -= iter->Size;
+    this->Entries.erase(iter);
+  }
+
+  // Evicts least-recently-used entries until the cache fits in the budget.
+  void Trim()
+  {
+    while (!this->Entries.empty() && this->Used > this->Budget)
+    {
+      this->Erase(std::prev(this->Entries.end()));
+    }
+  }
+
+  std::mutex Mutex;
+  // most recently used entry first.
+  std::list<Entry> Entries;
+  vtkTypeInt64 Budget = 0;
+  vtkTypeInt64 Used = 0;
+};
+
+vtkTemporalCache& GetTemporalCache()
+{
+  static vtkTemporalCache cache;
+  return cache;
+}
+
+// Fills the key for the current request on the output information. Only
+// temporal requests are cached. Requests for a subset of the blocks are not,
+// since the key does not capture which blocks were requested.
+bool GetTemporalCacheKey(vtkInformation* outInfo, vtkTemporalCacheKey& key)
+{
+  if (!outInfo || !outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP()) ||
+    outInfo->Has(vtkCompositeDataPipeline::UPDATE_COMPOSITE_INDICES()) ||
+    outInfo->Has(vtkCompositeDataPipeline::LOAD_REQUESTED_BLOCKS()))
+  {
+    return false;
+  }
+  key.Time = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP());
+  if (outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER()))
+  {
+    key.Piece = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER());
+  }
+  if (outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_PIECES()))
+  {
+    key.NumberOfPieces = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_PIECES());
+  }
+  if (outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_GHOST_LEVELS()))
+  {
+    key.GhostLevels =
+      outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_GHOST_LEVELS());
+  }
+  if (outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT()))
+  {
+    outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), key.Extent);
+  }
+  return true;
+}
+}
 
 vtkStandardNewMacro(vtkPVCompositeDataPipeline);
+vtkInformationKeyMacro(vtkPVCompositeDataPipeline, ALLOW_TEMPORAL_CACHE, Integer);
 //----------------------------------------------------------------------------
 vtkPVCompositeDataPipeline::vtkPVCompositeDataPipeline() = default;
 
 //----------------------------------------------------------------------------
-vtkPVCompositeDataPipeline::~vtkPVCompositeDataPipeline() = default;
+vtkPVCompositeDataPipeline::~vtkPVCompositeDataPipeline()
+{
+  GetTemporalCache().Remove(this);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVCompositeDataPipeline::SetTemporalCacheMemoryBudget(vtkTypeInt64 kibibytes)
+{
+  GetTemporalCache().SetBudget(kibibytes);
+}
+
+//----------------------------------------------------------------------------
+vtkTypeInt64 vtkPVCompositeDataPipeline::GetTemporalCacheMemoryBudget()
+{
+  return GetTemporalCache().GetBudget();
+}
+
+//----------------------------------------------------------------------------
+vtkTypeInt64 vtkPVCompositeDataPipeline::GetTemporalCacheMemoryUse()
+{
+  return GetTemporalCache().GetUsed();
+}
+
+//----------------------------------------------------------------------------
+void vtkPVCompositeDataPipeline::ReleaseTemporalCache()
+{
+  GetTemporalCache().Clear();
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVCompositeDataPipeline::CanUseTemporalCache()
+{
+  // Algorithms with several output ports generate all of them at once, a
+  // single cached port cannot stand for the others.
+  if (GetTemporalCache().GetBudget() <= 0 || this->GetNumberOfOutputPorts() != 1 ||
+    !this->Algorithm || this->Algorithm->GetInformation()->Get(ALLOW_TEMPORAL_CACHE()) == 0)
+  {
+    return false;
+  }
+
+  // Each rank would decide on its own whether to execute, deadlocking
+  // algorithms that communicate while executing.
+  auto controller = vtkMultiProcessController::GetGlobalController();
+  return controller == nullptr || controller->GetNumberOfProcesses() <= 1;
+}
+
+//----------------------------------------------------------------------------
+int vtkPVCompositeDataPipeline::NeedToExecuteData(
+  int outputPort, vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec)
+{
+  if (!this->Superclass::NeedToExecuteData(outputPort, inInfoVec, outInfoVec))
+  {
+    return 0;
+  }
+
+  vtkTemporalCacheKey key;
+  vtkInformation* outInfo = outInfoVec->GetInformationObject(0);
+  if (this->ContinueExecuting || !this->CanUseTemporalCache() ||
+    !GetTemporalCacheKey(outInfo, key))
+  {
+    return 1;
+  }
+
+  vtkTemporalCache::Entry entry;
+  vtkDataObject* output = outInfo->Get(vtkDataObject::DATA_OBJECT());
+  if (!output || !GetTemporalCache().Find(this, key, this->PipelineMTime, entry) ||
+    strcmp(output->GetClassName(), entry.Data->GetClassName()) != 0)
+  {
+    return 1;
+  }
+
+  output->ShallowCopy(entry.Data);
+  output->GetInformation()->Set(vtkDataObject::DATA_TIME_STEP(), entry.DataTime);
+  outInfo->Remove(DATA_NOT_GENERATED());
+  output->DataHasBeenGenerated();
+  return 0;
+}
+
+//----------------------------------------------------------------------------
+int vtkPVCompositeDataPipeline::ExecuteData(
+  vtkInformation* request, vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec)
+{
+  const int result = this->Superclass::ExecuteData(request, inInfoVec, outInfoVec);
+
+  // Partial results of algorithms iterating over several requests are not
+  // cached.
+  vtkTemporalCacheKey key;
+  vtkInformation* outInfo = outInfoVec->GetInformationObject(0);
+  if (!result || request->Has(CONTINUE_EXECUTING()) || !this->CanUseTemporalCache() ||
+    !GetTemporalCacheKey(outInfo, key))
+  {
+    return result;
+  }
+
+  vtkDataObject* output = outInfo->Get(vtkDataObject::DATA_OBJECT());
+  if (output)
+  {
+    vtkInformation* dataInfo = output->GetInformation();
+    const double dataTime = dataInfo->Has(vtkDataObject::DATA_TIME_STEP())
+      ? dataInfo->Get(vtkDataObject::DATA_TIME_STEP())
+      : key.Time;
+    GetTemporalCache().Add(this, key, this->PipelineMTime, dataTime, output);
+  }
+  return result;
+}
 
 //----------------------------------------------------------------------------
 void vtkPVCompositeDataPipeline::CopyDefaultInformation(vtkInformation* request, int direction,
@@ -88,4 +385,6 @@ void vtkPVCompositeDataPipeline::ResetPipelineInformation(int port, vtkInformati
 void vtkPVCompositeDataPipeline::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "TemporalCacheMemoryBudget: " << GetTemporalCache().GetBudget() << endl;
+  os << indent << "TemporalCacheMemoryUse: " << GetTemporalCache().GetUsed() << endl;
 }
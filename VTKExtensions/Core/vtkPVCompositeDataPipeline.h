@@ -23,6 +23,15 @@
  *     algorithms are passed along to the input vtkPVPostFilter, if one exists.
  *     vtkPVPostFilter is used to automatically extract components or generated
  *     derived arrays such as magnitude array for vectors.
+ * \li Temporal Cache :- outputs generated for a requested timestep can be kept
+ *     in a process-wide cache shared by all executives. When a timestep that
+ *     is still cached is requested again and nothing upstream was modified,
+ *     the cached output is reused and the upstream pipeline is not executed.
+ *     Cached outputs are evicted in least-recently-used order to keep the total
+ *     size under the budget set with SetTemporalCacheMemoryBudget. The cache is
+ *     disabled by default. Only outputs of algorithms that opted in with
+ *     ALLOW_TEMPORAL_CACHE are cached, and only when running on a single
+ *     process.
  */
 
 #ifndef vtkPVCompositeDataPipeline_h
@@ -31,6 +40,8 @@
 #include "vtkCompositeDataPipeline.h"
 #include "vtkPVVTKExtensionsCoreModule.h" // needed for export macro
 
+class vtkInformationIntegerKey;
+
 class VTKPVVTKEXTENSIONSCORE_EXPORT vtkPVCompositeDataPipeline : public vtkCompositeDataPipeline
 {
 public:
@@ -38,6 +49,37 @@ public:
   vtkTypeMacro(vtkPVCompositeDataPipeline, vtkCompositeDataPipeline);
   void PrintSelf(ostream& os, vtkIndent indent) override;
 
+  ///@{
+  /**
+   * Get/Set the memory budget, in KiB, for the temporal cache shared by all
+   * vtkPVCompositeDataPipeline executives in this process. 0 (default)
+   * disables the cache and releases all cached outputs. Lowering the budget
+   * evicts least-recently-used outputs immediately.
+   */
+  static void SetTemporalCacheMemoryBudget(vtkTypeInt64 kibibytes);
+  static vtkTypeInt64 GetTemporalCacheMemoryBudget();
+  ///@}
+
+  /**
+   * Returns the total size, in KiB, of the outputs currently held in the
+   * temporal cache as reported by vtkDataObject::GetActualMemorySize.
+   */
+  static vtkTypeInt64 GetTemporalCacheMemoryUse();
+
+  /**
+   * Releases all outputs held in the temporal cache.
+   */
+  static void ReleaseTemporalCache();
+
+  /**
+   * Key set on the information of an algorithm (vtkAlgorithm::GetInformation)
+   * to let the temporal cache keep its output. Algorithms must only opt in
+   * when their output depends on nothing but their inputs, their parameters
+   * and the requested time, piece and extent, and is not modified in place
+   * once generated. Readers and trivial producers are not expected to opt in.
+   */
+  static vtkInformationIntegerKey* ALLOW_TEMPORAL_CACHE();
+
 protected:
   vtkPVCompositeDataPipeline();
   ~vtkPVCompositeDataPipeline() override;
@@ -49,6 +91,18 @@ protected:
   // Remove update/whole extent when resetting pipeline information.
   void ResetPipelineInformation(int port, vtkInformation*) override;
 
+  // Serve the request from the temporal cache, when possible.
+  int NeedToExecuteData(
+    int outputPort, vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec) override;
+
+  // Add the generated output to the temporal cache.
+  int ExecuteData(vtkInformation* request, vtkInformationVector** inInfoVec,
+    vtkInformationVector* outInfoVec) override;
+
+  // Whether the output of the algorithm may be served from or added to the
+  // temporal cache.
+  bool CanUseTemporalCache();
+
 private:
   vtkPVCompositeDataPipeline(const vtkPVCompositeDataPipeline&) = delete;
   void operator=(const vtkPVCompositeDataPipeline&) = delete;
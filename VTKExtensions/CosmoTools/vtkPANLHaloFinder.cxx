@@ -25,6 +25,8 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkTypeInt64Array.h"
 #include "vtkUnstructuredGrid.h"
 
@@ -37,6 +39,7 @@
 #include "SubHaloFinder.h"
 
 #include <cassert>
+#include <memory>
 #include <vector>
 
 namespace
@@ -672,55 +675,78 @@ void vtkPANLHaloFinder::FindCenters(
   centers->SetNumberOfComponents(3);
   centers->SetNumberOfTuples(numberOfFOFHalos);
 
-  ExtractHalo haloData(numberOfFOFHalos, fofHaloCount, this->Internal->fof);
-  for (int halo = 0; halo < numberOfFOFHalos; ++halo)
+  if (this->CenterFindingMode != MOST_BOUND_PARTICLE &&
+    this->CenterFindingMode != MOST_CONNECTED_PARTICLE &&
+    this->CenterFindingMode != HIST_CENTER_FINDING)
+  {
+    return;
+  }
+
+  if (allParticles->GetNumberOfPoints() > 0)
   {
-    haloData.SetCurrentHalo(halo);
-    cosmotk::HaloCenterFinder centerFinder;
-    haloData.SetParticles(centerFinder);
-    centerFinder.setParameters(this->BB, this->SmoothingLength, this->DistanceConvertFactor,
-      this->RL, this->NP, OmegaMatter, OmegaCB, this->Hubble, this->RedShift);
-    int centerIndex = -1;
-    if (this->CenterFindingMode == MOST_BOUND_PARTICLE)
+    // GetPoint is only thread safe once it has been called from a single thread.
+    double firstPoint[3];
+    allParticles->GetPoint(0, firstPoint);
+  }
+
+  // Halos are independent, so their centers are found in parallel. Each thread
+  // extracts halos in its own buffers. Halo sizes vary widely, hence the grain
+  // of 1 for load balancing.
+  vtkSMPThreadLocal<std::shared_ptr<ExtractHalo>> tlHaloData;
+  vtkSMPTools::For(0, numberOfFOFHalos, 1, [&](vtkIdType begin, vtkIdType end) {
+    auto& haloDataPtr = tlHaloData.Local();
+    if (!haloDataPtr)
+    {
+      haloDataPtr =
+        std::make_shared<ExtractHalo>(numberOfFOFHalos, fofHaloCount, this->Internal->fof);
+    }
+    ExtractHalo& haloData = *haloDataPtr;
+    for (vtkIdType halo = begin; halo < end; ++halo)
     {
-      float minPotential;
-      if (haloData.GetNumberOfParticlesInCurrentHalo() < MBP_THRESHOLD)
+      haloData.SetCurrentHalo(static_cast<int>(halo));
+      cosmotk::HaloCenterFinder centerFinder;
+      haloData.SetParticles(centerFinder);
+      centerFinder.setParameters(this->BB, this->SmoothingLength, this->DistanceConvertFactor,
+        this->RL, this->NP, OmegaMatter, OmegaCB, this->Hubble, this->RedShift);
+      int centerIndex = -1;
+      if (this->CenterFindingMode == MOST_BOUND_PARTICLE)
       {
-        centerIndex = centerFinder.mostBoundParticleN2(&minPotential);
+        float minPotential;
+        if (haloData.GetNumberOfParticlesInCurrentHalo() < MBP_THRESHOLD)
+        {
+          centerIndex = centerFinder.mostBoundParticleN2(&minPotential);
+        }
+        else
+        {
+          centerIndex = centerFinder.mostBoundParticleAStar(&minPotential);
+        }
       }
-      else
+      else if (this->CenterFindingMode == MOST_CONNECTED_PARTICLE)
       {
-        centerIndex = centerFinder.mostBoundParticleAStar(&minPotential);
+        if (haloData.GetNumberOfParticlesInCurrentHalo() < MCP_THRESHOLD)
+        {
+          centerIndex = centerFinder.mostConnectedParticleN2();
+        }
+        else
+        {
+          centerIndex = centerFinder.mostConnectedParticleChainMesh();
+        }
       }
-    }
-    else if (this->CenterFindingMode == MOST_CONNECTED_PARTICLE)
-    {
-      if (haloData.GetNumberOfParticlesInCurrentHalo() < MCP_THRESHOLD)
+      else // HIST_CENTER_FINDING
       {
-        centerIndex = centerFinder.mostConnectedParticleN2();
+        centerIndex = centerFinder.mostConnectedParticleHist();
       }
-      else
+      float center[] = { 0.0, 0.0, 0.0 };
+      if (centerIndex >= 0)
       {
-        centerIndex = centerFinder.mostConnectedParticleChainMesh();
+        double point[3];
+        allParticles->GetPoint(haloData.GetActualIndex(centerIndex), point);
+        center[0] = point[0];
+        center[1] = point[1];
+        center[2] = point[2];
       }
+      centers->SetTypedTuple(halo, center);
     }
-    else if (this->CenterFindingMode == HIST_CENTER_FINDING)
-    {
-      centerIndex = centerFinder.mostConnectedParticleHist();
-    }
-    else
-    {
-      return;
-    }
-    float center[] = { 0.0, 0.0, 0.0 };
-    if (centerIndex >= 0)
-    {
-      double* point = allParticles->GetPoint(haloData.GetActualIndex(centerIndex));
-      center[0] = point[0];
-      center[1] = point[1];
-      center[2] = point[2];
-    }
-    centers->SetTypedTuple(halo, center);
-  }
+  });
   fofProperties->GetPointData()->AddArray(centers.GetPointer());
 }
@@ -82,6 +82,7 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkUnsignedCharArray.h"
@@ -625,23 +626,37 @@ void vtkPLANLHaloFinder::ComputeFOFHalos(
   double* haloVelDisp = static_cast<double*>(PD->GetArray("VelocityDispersion")->GetVoidPointer(0));
   int* haloId = static_cast<int*>(PD->GetArray("HaloID")->GetVoidPointer(0));
 
-  double center[3];
-  for (unsigned int halo = 0; halo < this->Halos->ExtractedHalos.size(); ++halo)
+  // Halos are independent: each one marks its own particles and writes its own
+  // output tuples, so their centers are computed in parallel. Halo sizes vary
+  // widely, hence the grain of 1 for load balancing.
+  if (particles->GetNumberOfPoints() > 0)
   {
-    int haloIdx = this->Halos->ExtractedHalos[halo];
-    assert("pre: haloIdx is out-of-bounds!" && (haloIdx >= 0) &&
-      (haloIdx < static_cast<int>(this->Halos->fofMass.size())));
-
-    this->MarkHaloParticlesAndGetCenter(halo, haloIdx, center, particles);
-    pnts->SetPoint(halo, center);
-
-    haloMass[halo] = this->Halos->fofMass[haloIdx];
-    haloVelDisp[halo] = this->Halos->fofVelDisp[haloIdx];
-    haloAverageVel[halo * 3] = this->Halos->fofXVel[haloIdx];
-    haloAverageVel[halo * 3 + 1] = this->Halos->fofYVel[haloIdx];
-    haloAverageVel[halo * 3 + 2] = this->Halos->fofZVel[haloIdx];
-    haloId[halo] = halo;
-  } // END for all extracted halos
+    // GetPoint is only thread safe once it has been called from a single thread.
+    double firstPoint[3];
+    particles->GetPoint(0, firstPoint);
+  }
+  const vtkIdType numberOfExtractedHalos =
+    static_cast<vtkIdType>(this->Halos->ExtractedHalos.size());
+  vtkSMPTools::For(0, numberOfExtractedHalos, 1, [&](vtkIdType begin, vtkIdType end) {
+    double center[3];
+    for (vtkIdType halo = begin; halo < end; ++halo)
+    {
+      int haloIdx = this->Halos->ExtractedHalos[halo];
+      assert("pre: haloIdx is out-of-bounds!" && (haloIdx >= 0) &&
+        (haloIdx < static_cast<int>(this->Halos->fofMass.size())));
+
+      this->MarkHaloParticlesAndGetCenter(
+        static_cast<unsigned int>(halo), haloIdx, center, particles);
+      pnts->SetPoint(halo, center);
+
+      haloMass[halo] = this->Halos->fofMass[haloIdx];
+      haloVelDisp[halo] = this->Halos->fofVelDisp[haloIdx];
+      haloAverageVel[halo * 3] = this->Halos->fofXVel[haloIdx];
+      haloAverageVel[halo * 3 + 1] = this->Halos->fofYVel[haloIdx];
+      haloAverageVel[halo * 3 + 2] = this->Halos->fofZVel[haloIdx];
+      haloId[halo] = static_cast<int>(halo);
+    } // END for all extracted halos
+  });
 }
 
 //------------------------------------------------------------------------------
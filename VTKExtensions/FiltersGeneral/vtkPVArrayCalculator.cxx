@@ -27,7 +27,6 @@
 #include "vtkPointData.h"
 #include "vtkTable.h"
 
-#include <algorithm>
 #include <cassert>
 #include <set>
 #include <sstream>
@@ -54,25 +53,6 @@ bool vtkInQuotes(const char* s)
 {
   return s[0] == '\"' && s[strlen(s) - 1] == '\"';
 }
-
-class add_scalar_variables
-{
-  vtkPVArrayCalculator* Calc;
-  const char* ArrayName;
-  int Component;
-
-public:
-  add_scalar_variables(vtkPVArrayCalculator* calc, const char* array_name, int component_num)
-    : Calc(calc)
-    , ArrayName(array_name)
-    , Component(component_num)
-  {
-  }
-  void operator()(const std::string& name)
-  {
-    this->Calc->AddScalarVariable(name.c_str(), this->ArrayName, this->Component);
-  }
-};
 }
 
 vtkStandardNewMacro(vtkPVArrayCalculator);
@@ -121,16 +101,56 @@ void vtkPVArrayCalculator::ResetArrayAndVariableNames()
   // It's safe to call these methods in RequestData() since they don't call
   // this->Modified().
   this->RemoveAllVariables();
+  this->AddedVariables.clear();
+}
+
+// ----------------------------------------------------------------------------
+bool vtkPVArrayCalculator::IsVariableReferenced(const std::string& variableName)
+{
+  // A plain substring test may keep a few variables that are not used (e.g.
+  // "coords" when only "coordsX" is), but never drops one that is.
+  const char* function = this->GetFunction();
+  return !function || strstr(function, variableName.c_str()) != nullptr;
+}
+
+// ----------------------------------------------------------------------------
+void vtkPVArrayCalculator::AddScalarVariableIfNeeded(
+  const std::string& variableName, const char* arrayName, int component)
+{
+  const std::string key = variableName + '\n' + arrayName + '\n' + std::to_string(component);
+  if (this->IsVariableReferenced(variableName) && this->AddedVariables.insert(key).second)
+  {
+    this->AddScalarVariable(variableName.c_str(), arrayName, component);
+  }
+}
+
+// ----------------------------------------------------------------------------
+void vtkPVArrayCalculator::AddVectorVariableIfNeeded(
+  const std::string& variableName, const char* arrayName)
+{
+  const std::string key = variableName + '\n' + arrayName + "\nvector";
+  if (this->IsVariableReferenced(variableName) && this->AddedVariables.insert(key).second)
+  {
+    this->AddVectorVariable(variableName.c_str(), arrayName);
+  }
 }
 
 // ----------------------------------------------------------------------------
 void vtkPVArrayCalculator::AddCoordinateVariableNames()
 {
   // Add coordinate scalar and vector variables
-  this->AddCoordinateScalarVariable("coordsX", 0);
-  this->AddCoordinateScalarVariable("coordsY", 1);
-  this->AddCoordinateScalarVariable("coordsZ", 2);
-  this->AddCoordinateVectorVariable("coords", 0, 1, 2);
+  const char* scalarNames[3] = { "coordsX", "coordsY", "coordsZ" };
+  for (int cc = 0; cc < 3; ++cc)
+  {
+    if (this->IsVariableReferenced(scalarNames[cc]))
+    {
+      this->AddCoordinateScalarVariable(scalarNames[cc], cc);
+    }
+  }
+  if (this->IsVariableReferenced("coords"))
+  {
+    this->AddCoordinateVectorVariable("coords", 0, 1, 2);
+  }
 }
 
 // ----------------------------------------------------------------------------
@@ -149,10 +169,10 @@ void vtkPVArrayCalculator::AddArrayAndVariableNames(
     if (numberComps == 1)
     {
       std::string validVariableName = vtkArrayCalculator::CheckValidVariableName(arrayName);
-      this->AddScalarVariable(validVariableName.c_str(), arrayName);
+      this->AddScalarVariableIfNeeded(validVariableName, arrayName, 0);
       if (validVariableName == arrayName && !vtkInQuotes(arrayName))
       {
-        this->AddScalarVariable(vtkQuoteString(arrayName).c_str(), arrayName);
+        this->AddScalarVariableIfNeeded(vtkQuoteString(arrayName), arrayName, 0);
       }
     }
     else
@@ -193,17 +213,19 @@ void vtkPVArrayCalculator::AddArrayAndVariableNames(
           possibleNames.insert(vtkQuoteString(defaultName));
         }
 
-        std::for_each(
-          possibleNames.begin(), possibleNames.end(), add_scalar_variables(this, arrayName, i));
+        for (const auto& possibleName : possibleNames)
+        {
+          this->AddScalarVariableIfNeeded(possibleName, arrayName, i);
+        }
       }
 
       if (numberComps == 3)
       {
         std::string validVariableName = vtkArrayCalculator::CheckValidVariableName(arrayName);
-        this->AddVectorVariable(validVariableName.c_str(), arrayName);
+        this->AddVectorVariableIfNeeded(validVariableName, arrayName);
         if (validVariableName == arrayName && !vtkInQuotes(arrayName))
         {
-          this->AddVectorVariable(vtkQuoteString(arrayName).c_str(), arrayName);
+          this->AddVectorVariableIfNeeded(vtkQuoteString(arrayName), arrayName);
         }
       }
     }
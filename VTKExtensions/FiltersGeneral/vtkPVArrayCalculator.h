@@ -34,6 +34,9 @@
 #include "vtkArrayCalculator.h"
 #include "vtkPVVTKExtensionsFiltersGeneralModule.h" //needed for exports
 
+#include <set>    // for std::set
+#include <string> // for std::string
+
 class vtkDataObject;
 class vtkDataSetAttributes;
 
@@ -88,9 +91,30 @@ protected:
    */
   void AddArrayAndVariableNames(vtkDataObject* theInputObj, vtkDataSetAttributes* inDataAttrs);
 
+  /**
+   * Returns false if `variableName` cannot be referenced by the current
+   * function. Variables that are not referenced are not registered with the
+   * superclass, which keeps the number of variables the parser has to look up
+   * and update independent of the number of arrays in the input.
+   */
+  bool IsVariableReferenced(const std::string& variableName);
+
+  ///@{
+  /**
+   * Register a variable with the superclass, unless it is not referenced by
+   * the function or the same variable was already registered for another
+   * block of a composite dataset.
+   */
+  void AddScalarVariableIfNeeded(
+    const std::string& variableName, const char* arrayName, int component);
+  void AddVectorVariableIfNeeded(const std::string& variableName, const char* arrayName);
+  ///@}
+
 private:
   vtkPVArrayCalculator(const vtkPVArrayCalculator&) = delete;
   void operator=(const vtkPVArrayCalculator&) = delete;
+
+  std::set<std::string> AddedVariables;
 };
 //@}
 
@@ -26,14 +26,16 @@
 #include "vtkIdFilter.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
+#include "vtkMath.h"
 #include "vtkMinimalStandardRandomSequence.h"
 #include "vtkMultiBlockDataSet.h"
 #include "vtkMultiProcessController.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
-#include "vtkOctreePointLocator.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTetra.h"
@@ -53,6 +55,7 @@
 #include <numeric>
 #include <random>
 #include <set>
+#include <utility>
 #include <vector>
 
 static const std::string IDS_ARRAY_NAME = "vtkPVGlyphFilter_Ids";
@@ -66,7 +69,146 @@ class vtkPVGlyphFilter::vtkInternals
   std::vector<vtkTuple<double, 3>> Points;
   std::vector<vtkIdType> PointIds;
   size_t NextPointId;
-  vtkNew<vtkOctreePointLocator> Locator;
+
+  // Uniform grid binning this->Points, in CSR layout. Bins are at least
+  // NearestPointRadius wide so that the sample points within that radius of
+  // any location are in at most 3x3x3 bins: the 2 * radius wide search
+  // interval may overlap 3 bins along each axis.
+  double BinOrigin[3];
+  double BinSpacing[3];
+  int BinDimensions[3];
+  std::vector<vtkIdType> BinOffsets;
+  std::vector<vtkIdType> BinnedPoints;
+
+  //---------------------------------------------------------------------------
+  int GetBin(double x, int axis) const
+  {
+    const int bin =
+      static_cast<int>(std::floor((x - this->BinOrigin[axis]) / this->BinSpacing[axis]));
+    return std::min(std::max(bin, 0), this->BinDimensions[axis] - 1);
+  }
+
+  //---------------------------------------------------------------------------
+  void BuildSampleBins()
+  {
+    // guard against degenerate radii producing an excessive number of bins.
+    const int maxDimension = 1024;
+    double lengths[3];
+    this->Bounds.GetLengths(lengths);
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      this->BinOrigin[axis] = this->Bounds.GetMinPoint()[axis];
+      int dimension = this->NearestPointRadius > 0.0
+        ? static_cast<int>(std::min(lengths[axis] / this->NearestPointRadius,
+            static_cast<double>(maxDimension)))
+        : 1;
+      this->BinDimensions[axis] = std::max(dimension, 1);
+      this->BinSpacing[axis] =
+        lengths[axis] > 0.0 ? lengths[axis] / this->BinDimensions[axis] : 1.0;
+    }
+
+    const vtkIdType numberOfBins = static_cast<vtkIdType>(this->BinDimensions[0]) *
+      this->BinDimensions[1] * this->BinDimensions[2];
+    std::vector<vtkIdType> pointBins(this->Points.size());
+    this->BinOffsets.assign(numberOfBins + 1, 0);
+    for (size_t cc = 0; cc < this->Points.size(); ++cc)
+    {
+      const double* x = this->Points[cc].GetData();
+      pointBins[cc] = this->GetBin(x[0], 0) +
+        this->BinDimensions[0] *
+          (this->GetBin(x[1], 1) +
+            static_cast<vtkIdType>(this->BinDimensions[1]) * this->GetBin(x[2], 2));
+      ++this->BinOffsets[pointBins[cc] + 1];
+    }
+    std::partial_sum(this->BinOffsets.begin(), this->BinOffsets.end(), this->BinOffsets.begin());
+    std::vector<vtkIdType> insertAt(this->BinOffsets.begin(), this->BinOffsets.end() - 1);
+    this->BinnedPoints.resize(this->Points.size());
+    for (size_t cc = 0; cc < this->Points.size(); ++cc)
+    {
+      this->BinnedPoints[insertAt[pointBins[cc]]++] = static_cast<vtkIdType>(cc);
+    }
+  }
+
+  //---------------------------------------------------------------------------
+  // For each sample point, find the closest point of `ds` within
+  // NearestPointRadius. Rather than building a locator over all the points of
+  // `ds`, each point of `ds` is tested, in parallel, against the few sample
+  // points binned near it. Ties are broken on the point id so that the result
+  // does not depend on the number of threads.
+  void FindClosestPointsToSamples(vtkDataSet* ds, std::set<vtkIdType>& pointIds)
+  {
+    using ClosestPoint = std::pair<double, vtkIdType>;
+    const vtkIdType numberOfPoints = ds->GetNumberOfPoints();
+    if (numberOfPoints == 0 || this->Points.empty())
+    {
+      return;
+    }
+
+    // GetPoint is only thread safe once it has been called from a single thread.
+    double x[3];
+    ds->GetPoint(0, x);
+
+    const double radius = this->NearestPointRadius;
+    const double radius2 = radius * radius;
+    const ClosestPoint none(VTK_DOUBLE_MAX, -1);
+    vtkSMPThreadLocal<std::vector<ClosestPoint>> tlClosest;
+    vtkSMPTools::For(0, numberOfPoints, [&](vtkIdType begin, vtkIdType end) {
+      auto& closest = tlClosest.Local();
+      if (closest.empty())
+      {
+        closest.resize(this->Points.size(), none);
+      }
+      double pt[3];
+      int minBin[3], maxBin[3];
+      for (vtkIdType ptId = begin; ptId < end; ++ptId)
+      {
+        ds->GetPoint(ptId, pt);
+        for (int axis = 0; axis < 3; ++axis)
+        {
+          minBin[axis] = this->GetBin(pt[axis] - radius, axis);
+          maxBin[axis] = this->GetBin(pt[axis] + radius, axis);
+        }
+        for (int k = minBin[2]; k <= maxBin[2]; ++k)
+        {
+          for (int j = minBin[1]; j <= maxBin[1]; ++j)
+          {
+            for (int i = minBin[0]; i <= maxBin[0]; ++i)
+            {
+              const vtkIdType bin = i +
+                this->BinDimensions[0] *
+                  (j + static_cast<vtkIdType>(this->BinDimensions[1]) * k);
+              for (vtkIdType cc = this->BinOffsets[bin]; cc < this->BinOffsets[bin + 1]; ++cc)
+              {
+                const vtkIdType sampleId = this->BinnedPoints[cc];
+                const double dist2 =
+                  vtkMath::Distance2BetweenPoints(pt, this->Points[sampleId].GetData());
+                if (dist2 <= radius2 && ClosestPoint(dist2, ptId) < closest[sampleId])
+                {
+                  closest[sampleId] = ClosestPoint(dist2, ptId);
+                }
+              }
+            }
+          }
+        }
+      }
+    });
+
+    std::vector<ClosestPoint> closest(this->Points.size(), none);
+    for (const auto& local : tlClosest)
+    {
+      for (size_t cc = 0; cc < closest.size(); ++cc)
+      {
+        closest[cc] = std::min(closest[cc], local[cc]);
+      }
+    }
+    for (const auto& item : closest)
+    {
+      if (item.second >= 0)
+      {
+        pointIds.insert(item.second);
+      }
+    }
+  }
 
   // Used with SPATIALLY_UNIFORM_INVERSE_TRANSFORM_SAMPLING_*
   std::map<unsigned int, std::vector<double>> UniformSamplingVectorMap;
@@ -135,20 +277,7 @@ public:
 
     if (glyphMode == vtkPVGlyphFilter::SPATIALLY_UNIFORM_DISTRIBUTION)
     {
-      this->Locator->Initialize();
-      this->Locator->SetDataSet(ds);
-      this->Locator->BuildLocator();
-
-      for (auto iter : this->Points)
-      {
-        double dist2;
-        vtkIdType ptId = this->Locator->FindClosestPointWithinRadius(
-          this->NearestPointRadius, iter.GetData(), dist2);
-        if (ptId >= 0)
-        {
-          pointIds.insert(ptId);
-        }
-      }
+      this->FindClosestPointsToSamples(ds, pointIds);
     }
     else
     {
@@ -215,8 +344,8 @@ public:
 
     this->Bounds.Reset();
     this->Points.clear();
-    this->Locator->Initialize();
-    this->Locator->SetDataSet(nullptr);
+    this->BinOffsets.clear();
+    this->BinnedPoints.clear();
 
     this->UniformSamplingVectorMap.clear();
     this->SamplingRunningSum = 0;
@@ -437,6 +566,7 @@ public:
       {
         this->NearestPointRadius = 0.0001;
       }
+      this->BuildSampleBins();
     }
     else // if(glyphMode != vtkPVGlyphFilter::SPATIALLY_UNIFORM_INVERSE_TRANSFORM_SAMPLING_SURFACE
          // || glyphMode != vtkPVGlyphFilter::SPATIALLY_UNIFORM_INVERSE_TRANSFORM_SAMPLING_VOLUME)
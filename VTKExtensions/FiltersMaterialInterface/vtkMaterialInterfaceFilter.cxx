@@ -68,6 +68,8 @@
 #include "vtkDataSetSurfaceFilter.h"
 #include "vtkMarchingCubesTriangleCases.h"
 #include "vtkOBBTree.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkTriangleFilter.h"
 // STL
 #include <fstream>
@@ -1548,15 +1550,11 @@ vtkMaterialInterfaceFilter::vtkMaterialInterfaceFilter()
 {
   this->Controller = vtkMultiProcessController::GetGlobalController();
 
-#ifdef vtkMaterialInterfaceFilterPROFILE
   // Lets profile to see what takes the most time for large number of processes.
-  this->InitializeBlocksTimer = vtkSmartPointer<vtkTimerLog>::New();
-  this->ShareGhostBlocksTimer = vtkSmartPointer<vtkTimerLog>::New();
+  // The timers are only created once profiling is requested.
+  this->Profile = false;
   this->NumberOfBlocks = 0;
   this->NumberOfGhostBlocks = 0;
-  this->ProcessBlocksTimer = vtkSmartPointer<vtkTimerLog>::New();
-  this->ResolveEquivalencesTimer = vtkSmartPointer<vtkTimerLog>::New();
-#endif
 
 #ifdef vtkMaterialInterfaceFilterDEBUG
   int myProcId = this->Controller->GetLocalProcessId();
@@ -1848,10 +1846,11 @@ int vtkMaterialInterfaceFilter::InitializeBlocks(vtkNonOverlappingAMR* input,
   int numProcs = this->Controller->GetNumberOfProcesses();
   vtkMaterialInterfaceFilterHalfSphere* sphere = nullptr;
 
-#ifdef vtkMaterialInterfaceFilterPROFILE
   // Lets profile to see what takes the most time for large number of processes.
-  this->InitializeBlocksTimer->StartTimer();
-#endif
+  if (this->Profile)
+  {
+    this->InitializeBlocksTimer->StartTimer();
+  }
 
   // leaving this logic alone rather than moving it into the
   // this->ClipFunction conditional because I don't know enough of the class to
@@ -2022,22 +2021,17 @@ int vtkMaterialInterfaceFilter::InitializeBlocks(vtkNonOverlappingAMR* input,
     this->AddBlock(block, this->GetBlockGhostLevel());
   }
 
-#ifdef vtkMaterialInterfaceFilterPROFILE
-  // Lets profile to see what takes the most time for large number of processes.
-  this->InitializeBlocksTimer->StopTimer();
-#endif
-
-#ifdef vtkMaterialInterfaceFilterPROFILE
   // Lets profile to see what takes the most time for large number of processes.
-  this->ShareGhostBlocksTimer->StartTimer();
-#endif
+  if (this->Profile)
+  {
+    this->InitializeBlocksTimer->StopTimer();
+    this->ShareGhostBlocksTimer->StartTimer();
+  }
 
   // cerr << "start ghost blocks\n" << endl;
 
-#ifdef vtkMaterialInterfaceFilterPROFILE
   // Lets profile to see what takes the most time for large number of processes.
   this->NumberOfBlocks = this->NumberOfInputBlocks;
-#endif
 
   // Broadcast all of the block meta data to all processes.
   // Setup ghost layer blocks.
@@ -2047,10 +2041,11 @@ int vtkMaterialInterfaceFilter::InitializeBlocks(vtkNonOverlappingAMR* input,
     this->ShareGhostBlocks();
   }
 
-#ifdef vtkMaterialInterfaceFilterPROFILE
   // Lets profile to see what takes the most time for large number of processes.
-  this->ShareGhostBlocksTimer->StopTimer();
-#endif
+  if (this->Profile)
+  {
+    this->ShareGhostBlocksTimer->StopTimer();
+  }
 
   return VTK_OK;
 }
@@ -2878,10 +2873,8 @@ void vtkMaterialInterfaceFilter::ShareGhostBlocks()
   // Process, extent
   // ...
 
-#ifdef vtkMaterialInterfaceFilterPROFILE
   // Lets profile to see what takes the most time for large number of processes.
-  this->NumberOfGhostBlocks = this->GhostBlocks.size();
-#endif
+  this->NumberOfGhostBlocks = static_cast<long>(this->GhostBlocks.size());
 
   /*
 
@@ -3381,11 +3374,16 @@ void vtkMaterialInterfaceFilter::PrepareForPass(vtkNonOverlappingAMR* hbdsInput,
 int vtkMaterialInterfaceFilter::RequestData(vtkInformation* vtkNotUsed(request),
   vtkInformationVector** inputVector, vtkInformationVector* outputVector)
 {
-#ifdef vtkMaterialInterfaceFilterPROFILE
   // Lets profile to see what takes the most time for large number of processes.
   this->NumberOfBlocks = 0;
   this->NumberOfGhostBlocks = 0;
-#endif
+  if (this->Profile && !this->InitializeBlocksTimer)
+  {
+    this->InitializeBlocksTimer = vtkSmartPointer<vtkTimerLog>::New();
+    this->ShareGhostBlocksTimer = vtkSmartPointer<vtkTimerLog>::New();
+    this->ProcessBlocksTimer = vtkSmartPointer<vtkTimerLog>::New();
+    this->ResolveEquivalencesTimer = vtkSmartPointer<vtkTimerLog>::New();
+  }
 
   if (this->ClipFunction)
   {
@@ -3572,41 +3570,48 @@ int vtkMaterialInterfaceFilter::RequestData(vtkInformation* vtkNotUsed(request),
 
     //
     this->ProgressBlockInc = this->ProgressMaterialInc / (double)this->NumberOfInputBlocks / 2.0;
-//
-#ifdef vtkMaterialInterfaceFilterPROFILE
+    //
     // Lets profile to see what takes the most time for large number of processes.
-    this->ProcessBlocksTimer->StartTimer();
-#endif
+    if (this->Profile)
+    {
+      this->ProcessBlocksTimer->StartTimer();
+    }
+    // The blocks are processed serially: a fragment's flood fill crosses into
+    // neighboring and ghost blocks, fragment ids index the attribute arrays in
+    // creation order, and the fill accumulates into member buffers.
     int blockId;
     for (blockId = 0; blockId < this->NumberOfInputBlocks; ++blockId)
     {
       // build fragments
       this->ProcessBlock(blockId);
     }
-#ifdef vtkMaterialInterfaceFilterPROFILE
     // Lets profile to see what takes the most time for large number of processes.
-    this->ProcessBlocksTimer->StopTimer();
-#endif
+    if (this->Profile)
+    {
+      this->ProcessBlocksTimer->StopTimer();
+    }
     // char tmp[128];
     // sprintf(tmp, "C:/Law/tmp/mifSurface%d.vtp", this->Controller->GetLocalProcessId());
     // this->SaveBlockSurfaces(tmp);
     // sprintf(tmp, "C:/Law/tmp/mifGhost%d.vtp", this->Controller->GetLocalProcessId());
     // this->SaveGhostSurfaces(tmp);
 
-#ifdef vtkMaterialInterfaceFilterPROFILE
     // Lets profile to see what takes the most time for large number of processes.
-    this->ResolveEquivalencesTimer->StartTimer();
-#endif
+    if (this->Profile)
+    {
+      this->ResolveEquivalencesTimer->StartTimer();
+    }
 
     // resolve: Merge local and remote geometry
     // correct integrated attributes, finialize integrations
     this->PrepareForResolveEquivalences();
     this->ResolveEquivalences();
 
-#ifdef vtkMaterialInterfaceFilterPROFILE
     // Lets profile to see what takes the most time for large number of processes.
-    this->ResolveEquivalencesTimer->StopTimer();
-#endif
+    if (this->Profile)
+    {
+      this->ResolveEquivalencesTimer->StopTimer();
+    }
 
     // update the resolved fragment count, so that next pass will start
     // where we left off here
@@ -3662,65 +3667,66 @@ int vtkMaterialInterfaceFilter::RequestData(vtkInformation* vtkNotUsed(request),
        << " MTime: " << this->GetMTime() << "." << endl;
 #endif
 
-#ifdef vtkMaterialInterfaceFilterPROFILE
-  // Lets profile to see what takes the most time for large number of processes.
-  double initializeTime, shareGhostBlocksTime, processBlocksTime, resolveEquivalencesTime;
-  unsigned long numberOfBlocks, numberOfGhostBlocks;
-  initializeTime = this->InitializeBlocksTimer->GetElapsedTime();
-  shareGhostBlocksTime = this->ShareGhostBlocksTimer->GetElapsedTime();
-  processBlocksTime = this->ProcessBlocksTimer->GetElapsedTime();
-  resolveEquivalencesTime = this->ResolveEquivalencesTimer->GetElapsedTime();
-  numberOfBlocks = this->NumberOfBlocks;
-  numberOfGhostBlocks = this->NumberOfGhostBlocks;
-  if (this->Controller == 0)
-  {
-    cout << "InitializeTime: " << initializeTime << endl;
-    cout << "ShareGhostBlocksTime: " << shareGhostBlocksTime << endl;
-    cout << "NumberOfBlocks: " << numberOfBlocks << endl;
-    cout << "NumberOfGhostBlocks: " << numberOfGhostBlocks << endl;
-    cout << "ProcessBlocksTime: " << processBlocksTime << endl;
-    cout << "ResolveEquivalencesTimer: " << resolveEquivalencesTime << endl;
-  }
-  else
+  if (this->Profile)
   {
-    int numProcs = this->Controller->GetNumberOfProcesses();
-    if (this->Controller->GetLocalProcessId() == 0)
-    {
-      cout << "Process 0: \n";
-      cout << "  InitializeTime: " << initializeTime << endl;
-      cout << "  ShareGhostBlocksTime: " << shareGhostBlocksTime << endl;
-      cout << "  NumberOfBlocks: " << numberOfBlocks << endl;
-      cout << "  NumberOfGhostBlocks: " << numberOfGhostBlocks << endl;
-      cout << "  ProcessBlocksTime: " << processBlocksTime << endl;
-      cout << "  ResolveEquivalencesTimer: " << resolveEquivalencesTime << endl;
-      for (int procIdx = 1; procIdx < numProcs; ++procIdx)
+    // Lets profile to see what takes the most time for large number of processes.
+    double initializeTime, shareGhostBlocksTime, processBlocksTime, resolveEquivalencesTime;
+    unsigned long numberOfBlocks, numberOfGhostBlocks;
+    initializeTime = this->InitializeBlocksTimer->GetElapsedTime();
+    shareGhostBlocksTime = this->ShareGhostBlocksTimer->GetElapsedTime();
+    processBlocksTime = this->ProcessBlocksTimer->GetElapsedTime();
+    resolveEquivalencesTime = this->ResolveEquivalencesTimer->GetElapsedTime();
+    numberOfBlocks = this->NumberOfBlocks;
+    numberOfGhostBlocks = this->NumberOfGhostBlocks;
+    if (this->Controller == 0)
+    {
+      cout << "InitializeTime: " << initializeTime << endl;
+      cout << "ShareGhostBlocksTime: " << shareGhostBlocksTime << endl;
+      cout << "NumberOfBlocks: " << numberOfBlocks << endl;
+      cout << "NumberOfGhostBlocks: " << numberOfGhostBlocks << endl;
+      cout << "ProcessBlocksTime: " << processBlocksTime << endl;
+      cout << "ResolveEquivalencesTimer: " << resolveEquivalencesTime << endl;
+    }
+    else
+    {
+      int numProcs = this->Controller->GetNumberOfProcesses();
+      if (this->Controller->GetLocalProcessId() == 0)
       {
-        this->Controller->Receive(&initializeTime, 1, procIdx, 234908);
-        this->Controller->Receive(&shareGhostBlocksTime, 1, procIdx, 234909);
-        this->Controller->Receive(&processBlocksTime, 1, procIdx, 234910);
-        this->Controller->Receive(&resolveEquivalencesTime, 1, procIdx, 234911);
-        this->Controller->Receive(&numberOfBlocks, 1, procIdx, 234912);
-        this->Controller->Receive(&numberOfGhostBlocks, 1, procIdx, 234913);
-        cout << "Process " << procIdx << ": \n";
+        cout << "Process 0: \n";
         cout << "  InitializeTime: " << initializeTime << endl;
         cout << "  ShareGhostBlocksTime: " << shareGhostBlocksTime << endl;
         cout << "  NumberOfBlocks: " << numberOfBlocks << endl;
         cout << "  NumberOfGhostBlocks: " << numberOfGhostBlocks << endl;
         cout << "  ProcessBlocksTime: " << processBlocksTime << endl;
         cout << "  ResolveEquivalencesTimer: " << resolveEquivalencesTime << endl;
+        for (int procIdx = 1; procIdx < numProcs; ++procIdx)
+        {
+          this->Controller->Receive(&initializeTime, 1, procIdx, 234908);
+          this->Controller->Receive(&shareGhostBlocksTime, 1, procIdx, 234909);
+          this->Controller->Receive(&processBlocksTime, 1, procIdx, 234910);
+          this->Controller->Receive(&resolveEquivalencesTime, 1, procIdx, 234911);
+          this->Controller->Receive(&numberOfBlocks, 1, procIdx, 234912);
+          this->Controller->Receive(&numberOfGhostBlocks, 1, procIdx, 234913);
+          cout << "Process " << procIdx << ": \n";
+          cout << "  InitializeTime: " << initializeTime << endl;
+          cout << "  ShareGhostBlocksTime: " << shareGhostBlocksTime << endl;
+          cout << "  NumberOfBlocks: " << numberOfBlocks << endl;
+          cout << "  NumberOfGhostBlocks: " << numberOfGhostBlocks << endl;
+          cout << "  ProcessBlocksTime: " << processBlocksTime << endl;
+          cout << "  ResolveEquivalencesTimer: " << resolveEquivalencesTime << endl;
+        }
+      }
+      else
+      {
+        this->Controller->Send(&initializeTime, 1, 0, 234908);
+        this->Controller->Send(&shareGhostBlocksTime, 1, 0, 234909);
+        this->Controller->Send(&processBlocksTime, 1, 0, 234910);
+        this->Controller->Send(&resolveEquivalencesTime, 1, 0, 234911);
+        this->Controller->Send(&numberOfBlocks, 1, 0, 234912);
+        this->Controller->Send(&numberOfGhostBlocks, 1, 0, 234913);
       }
-    }
-    else
-    {
-      this->Controller->Send(&initializeTime, 1, 0, 234908);
-      this->Controller->Send(&shareGhostBlocksTime, 1, 0, 234909);
-      this->Controller->Send(&processBlocksTime, 1, 0, 234910);
-      this->Controller->Send(&resolveEquivalencesTime, 1, 0, 234911);
-      this->Controller->Send(&numberOfBlocks, 1, 0, 234912);
-      this->Controller->Send(&numberOfGhostBlocks, 1, 0, 234913);
     }
   }
-#endif
 
   return 1;
 }
@@ -5730,6 +5736,7 @@ void vtkMaterialInterfaceFilter::PrintSelf(ostream& os, vtkIndent indent)
 {
   // TODO print state
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "Profile: " << this->Profile << endl;
 }
 
 //----------------------------------------------------------------------------
@@ -6458,8 +6465,8 @@ void vtkMaterialInterfaceFilter::CleanLocalFragmentGeometry()
   assert("Couldn't get the resolved fragnments." && resolvedFragments);
   resolvedFragments->SetNumberOfPieces(this->NumberOfResolvedFragments);
 
-  // Only need to merge points.
-  vtkCleanPolyData* cpd = vtkCleanPolyData::New();
+  // Only need to merge points. Each thread gets its own cleaner.
+  vtkSMPThreadLocalObject<vtkCleanPolyData> cpds;
   // These caused some visual effects(rounded corners etc...)
   // cpd->ConvertLinesToPointsOff();
   // cpd->ConvertPolysToLinesOff();
@@ -6471,34 +6478,42 @@ void vtkMaterialInterfaceFilter::CleanLocalFragmentGeometry()
   vtkIdType nInitial = 0;
   vtkIdType nFinal = 0;
 #endif
-  // clean each frgament mesh we own.
+  // clean each frgament mesh we own. Fragments are independent of
+  // each other so they are cleaned concurrently.
   int nLocal = static_cast<int>(resolvedFragmentIds.size());
+  vector<vtkSmartPointer<vtkPolyData>> cleanedFragmentMeshes(nLocal);
+  vtkSMPTools::For(0, nLocal, [&](int first, int last) {
+    vtkCleanPolyData* cpd = cpds.Local();
+    for (int localId = first; localId < last; ++localId)
+    {
+      // get the fragment
+      vtkPolyData* fragmentMesh =
+        dynamic_cast<vtkPolyData*>(resolvedFragments->GetPiece(resolvedFragmentIds[localId]));
+      // clean duplicate points
+      cpd->SetInputData(fragmentMesh);
+      cpd->Update();
+      vtkPolyData* cleanedFragmentMesh = cpd->GetOutput();
+      // Free unused resources
+      cleanedFragmentMesh->Squeeze();
+      // Copy, the cleaner's output is reused for the next fragment.
+      cleanedFragmentMeshes[localId] = vtkSmartPointer<vtkPolyData>::New();
+      cleanedFragmentMeshes[localId]->ShallowCopy(cleanedFragmentMesh);
+    }
+  });
+
+  // Swap dirty old meshes for new cleaned meshes. The multipiece
+  // isn't thread safe so this is done serially.
   for (int localId = 0; localId < nLocal; ++localId)
   {
     // get the material id
     int fragmentId = resolvedFragmentIds[localId];
-    // get the fragment
-    vtkPolyData* fragmentMesh = dynamic_cast<vtkPolyData*>(resolvedFragments->GetPiece(fragmentId));
-#ifdef vtkMaterialInterfaceFilterDEBUG
-    nInitial += fragmentMesh->GetNumberOfPoints();
-#endif
-    // clean duplicate points
-    cpd->SetInputData(fragmentMesh);
-    cpd->Update();
-    vtkPolyData* cleanedFragmentMesh = cpd->GetOutput();
-
 #ifdef vtkMaterialInterfaceFilterDEBUG
-    nFinal += cleanedFragmentMesh->GetNumberOfPoints();
+    nInitial +=
+      dynamic_cast<vtkPolyData*>(resolvedFragments->GetPiece(fragmentId))->GetNumberOfPoints();
+    nFinal += cleanedFragmentMeshes[localId]->GetNumberOfPoints();
 #endif
-    // Free unused resources
-    cleanedFragmentMesh->Squeeze();
-    // Copy and swap dirty old mesh for new cleaned mesh.
-    vtkPolyData* cleanedFragmentMeshOut = vtkPolyData::New();
-    cleanedFragmentMeshOut->ShallowCopy(cleanedFragmentMesh);
-    resolvedFragments->SetPiece(fragmentId, cleanedFragmentMeshOut);
-    cleanedFragmentMeshOut->Delete();
-  }
-  cpd->Delete();
+    resolvedFragments->SetPiece(fragmentId, cleanedFragmentMeshes[localId]);
+  }
 #ifdef vtkMaterialInterfaceFilterDEBUG
   cerr << "[" << __LINE__ << "] " << myProcId << " cleaned " << nInitial - nFinal
        << " points from local fragments. ("
@@ -9250,55 +9265,53 @@ int vtkMaterialInterfaceFilter::ComputeLocalFragmentOBB()
 
   int nLocal = static_cast<int>(resolvedFragmentIds.size());
 
-  // OBB set up
-  vtkOBBTree* obbCalc;
-  double* pObb;
-  obbCalc = vtkOBBTree::New();
+  // OBB set up, each thread gets its own calculator.
+  vtkSMPThreadLocalObject<vtkOBBTree> obbCalcs;
   assert("FragmentOBBs has incorrect size." && this->FragmentOBBs->GetNumberOfTuples() == nLocal);
-  pObb = this->FragmentOBBs->GetPointer(0);
+  double* obbs = this->FragmentOBBs->GetPointer(0);
 
-  // Traverse the fragments we own
-  for (int i = 0; i < nLocal; ++i)
-  {
-    // skip split fragments, these have already been
-    // taken care of.
-    if (fragmentSplitMarker[i] == 1)
+  // Traverse the fragments we own, they are independent
+  // so they are processed concurrently.
+  vtkSMPTools::For(0, nLocal, [&](int first, int last) {
+    vtkOBBTree* obbCalc = obbCalcs.Local();
+    for (int i = first; i < last; ++i)
     {
-      pObb += 15;
-      continue;
-    }
+      // skip split fragments, these have already been
+      // taken care of.
+      if (fragmentSplitMarker[i] == 1)
+      {
+        continue;
+      }
+      double* pObb = obbs + 15 * i;
 
-    // get fragment mesh
-    int globalId = resolvedFragmentIds[i];
-    vtkPolyData* thisFragment = dynamic_cast<vtkPolyData*>(resolvedFragments->GetPiece(globalId));
+      // get fragment mesh
+      int globalId = resolvedFragmentIds[i];
+      vtkPolyData* thisFragment =
+        dynamic_cast<vtkPolyData*>(resolvedFragments->GetPiece(globalId));
 
-    // compute OBB
-    double size[3];
-    // (c_x,c_y,c_z),(max_x,max_y,max_z),(mid_x,mid_y,mid_z),(min_x,min_y,min_z),|max|,|mid|,|min|
-    obbCalc->ComputeOBB(thisFragment, pObb, pObb + 3, pObb + 6, pObb + 9, size);
-    // obbCalc->ComputeOBB(thisFragment->GetPoints(),pObb,pObb+3,pObb+6,pObb+9,size);
+      // compute OBB
+      double size[3];
+      // (c_x,c_y,c_z),(max_x,max_y,max_z),(mid_x,mid_y,mid_z),(min_x,min_y,min_z),|max|,|mid|,|min|
+      obbCalc->ComputeOBB(thisFragment, pObb, pObb + 3, pObb + 6, pObb + 9, size);
+      // obbCalc->ComputeOBB(thisFragment->GetPoints(),pObb,pObb+3,pObb+6,pObb+9,size);
 
-    // compute magnitudes
-    for (int q = 0; q < 3; ++q)
-    {
-      pObb[12 + q] = 0;
-    }
-    for (int q = 0; q < 3; ++q)
-    {
-      pObb[12] += pObb[3 + q] * pObb[3 + q];
-      pObb[13] += pObb[6 + q] * pObb[6 + q];
-      pObb[14] += pObb[9 + q] * pObb[9 + q];
-    }
-    for (int q = 0; q < 3; ++q)
-    {
-      pObb[12 + q] = sqrt(pObb[12 + q]);
+      // compute magnitudes
+      for (int q = 0; q < 3; ++q)
+      {
+        pObb[12 + q] = 0;
+      }
+      for (int q = 0; q < 3; ++q)
+      {
+        pObb[12] += pObb[3 + q] * pObb[3 + q];
+        pObb[13] += pObb[6 + q] * pObb[6 + q];
+        pObb[14] += pObb[9 + q] * pObb[9 + q];
+      }
+      for (int q = 0; q < 3; ++q)
+      {
+        pObb[12 + q] = sqrt(pObb[12 + q]);
+      }
     }
-
-    pObb += 15;
-  } // fragment traversal
-
-  // OBB clean up
-  obbCalc->Delete();
+  }); // fragment traversal
 
   return 1;
 }
@@ -9321,32 +9334,35 @@ int vtkMaterialInterfaceFilter::ComputeLocalFragmentAABBCenters()
   // AABB set up
   assert("FragmentAABBCenters is expected to be pre-allocated." &&
     this->FragmentAABBCenters->GetNumberOfTuples() == nLocal);
-  double aabb[6];
-  double* pCoaabb = this->FragmentAABBCenters->GetPointer(0);
+  double* coaabbs = this->FragmentAABBCenters->GetPointer(0);
 
-  // Traverse the fragments we own
-  for (int i = 0; i < nLocal; ++i)
-  {
-    // skip fragments with geometry split over multiple
-    // processes. These have been already taken care of.
-    if (fragmentSplitMarker[i] == 1)
+  // Traverse the fragments we own, they are independent
+  // so they are processed concurrently.
+  vtkSMPTools::For(0, nLocal, [&](int first, int last) {
+    double aabb[6];
+    for (int i = first; i < last; ++i)
     {
-      pCoaabb += 3;
-      continue;
-    }
+      // skip fragments with geometry split over multiple
+      // processes. These have been already taken care of.
+      if (fragmentSplitMarker[i] == 1)
+      {
+        continue;
+      }
+      double* pCoaabb = coaabbs + 3 * i;
 
-    int globalId = resolvedFragmentIds[i];
+      int globalId = resolvedFragmentIds[i];
 
-    vtkPolyData* thisFragment = dynamic_cast<vtkPolyData*>(resolvedFragments->GetPiece(globalId));
+      vtkPolyData* thisFragment =
+        dynamic_cast<vtkPolyData*>(resolvedFragments->GetPiece(globalId));
 
-    // AABB calculation
-    thisFragment->GetBounds(aabb);
-    for (int q = 0, k = 0; q < 3; ++q, k += 2)
-    {
-      pCoaabb[q] = (aabb[k] + aabb[k + 1]) / 2.0;
+      // AABB calculation
+      thisFragment->GetBounds(aabb);
+      for (int q = 0, k = 0; q < 3; ++q, k += 2)
+      {
+        pCoaabb[q] = (aabb[k] + aabb[k + 1]) / 2.0;
+      }
     }
-    pCoaabb += 3;
-  } // fragment traversal
+  }); // fragment traversal
 
   return 1;
 }
@@ -26,10 +26,13 @@
  * #define vtkMaterialInterfaceFilterDEBUG
  * \endcode
  *
- * This will turn on profiling of how long each part of the filter takes
- * \code{.cpp}
- * #define vtkMaterialInterfaceFilterPROFILE
- * \endcode
+ * Profiling of how long each part of the filter takes can be turned on at
+ * run time, see SetProfile().
+ *
+ * The per fragment passes run after fragments are resolved (cleaning the
+ * local fragment geometry, computing OBBs and AABB centers) are independent
+ * from one fragment to the next and are executed with vtkSMPTools. The
+ * connectivity pass that extracts the fragments from the blocks is serial.
  */
 
 #ifndef vtkMaterialInterfaceFilter_h
@@ -305,6 +308,18 @@ public:
   vtkGetMacro(BlockGhostLevel, unsigned char);
   ///@}
 
+  ///@{
+  /**
+   * If true, time how long block initialization, ghost block exchange,
+   * fragment extraction and equivalence resolution take on each process.
+   * The timings are reported on the standard output of process 0 at the
+   * end of each execution. Off by default.
+   */
+  vtkSetMacro(Profile, bool);
+  vtkGetMacro(Profile, bool);
+  vtkBooleanMacro(Profile, bool);
+  ///@}
+
   /**
    * Sets modified if array selection changes.
    */
@@ -713,15 +728,14 @@ protected:
   // By default set to 1
   unsigned char BlockGhostLevel;
 
-#ifdef vtkMaterialInterfaceFilterPROFILE
   // Lets profile to see what takes the most time for large number of processes.
+  bool Profile;
   vtkSmartPointer<vtkTimerLog> InitializeBlocksTimer;
   vtkSmartPointer<vtkTimerLog> ShareGhostBlocksTimer;
   long NumberOfBlocks;
   long NumberOfGhostBlocks;
   vtkSmartPointer<vtkTimerLog> ProcessBlocksTimer;
   vtkSmartPointer<vtkTimerLog> ResolveEquivalencesTimer;
-#endif
 
 private:
   vtkMaterialInterfaceFilter(const vtkMaterialInterfaceFilter&) = delete;
@@ -9,6 +9,7 @@
 #include "vtkDataObjectTreeIterator.h"
 #include "vtkDataSetAttributes.h"
 #include "vtkDemandDrivenPipeline.h"
+#include "vtkIdList.h"
 #include "vtkInformation.h"
 #include "vtkInformationIntegerKey.h"
 #include "vtkInformationVector.h"
@@ -23,10 +24,11 @@
 #include "vtkStringArray.h"
 #include "vtkTable.h"
 #include "vtkUnsignedCharArray.h"
-#include "vtkVariantArray.h"
 
+#include <numeric>
 #include <set>
 #include <sstream>
+#include <vector>
 
 vtkCxxSetObjectMacro(vtkSciVizStatistics, Controller, vtkMultiProcessController);
 
@@ -609,8 +611,8 @@ int vtkSciVizStatistics::PrepareFullDataTable(vtkTable* inTable, vtkFieldData* d
         }
         else if (sarr)
         {
-          std::vector<vtkStringArray*> scomps;
-          for (int i = 0; i < ncomp; ++i, ++vidx)
+          std::vector<vtkStringArray*> scomps(ncomp);
+          for (int i = 0; i < ncomp; ++i)
           {
             scomps[i] = vtkStringArray::SafeDownCast(comps[i]);
           }
@@ -665,8 +667,11 @@ int vtkSciVizStatistics::PrepareTrainingTable(
 
   vtkUnsignedCharArray* ghosts = fullDataTable->GetRowData()->GetGhostArray();
 
-  std::set<vtkIdType> trainRows;
+  // Training rows are flagged in a bitmask rather than stored in an ordered
+  // set, which would cost several pointers per selected row.
   vtkIdType N = fullDataTable->GetNumberOfRows();
+  std::vector<bool> trainRows(N, false);
+  vtkIdType numberOfTrainRows = 0;
   double frac = static_cast<double>(M) / static_cast<double>(N);
   vtkNew<vtkMinimalStandardRandomSequence> rand;
   for (vtkIdType i = 0; i < N; ++i)
@@ -678,44 +683,59 @@ int vtkSciVizStatistics::PrepareTrainingTable(
     rand->Next();
     if (rand->GetValue() < frac)
     {
-      trainRows.insert(i);
+      trainRows[i] = true;
+      ++numberOfTrainRows;
     }
   }
   // Now add or subtract entries as required.
-  N = N - 1;
-  while (static_cast<vtkIdType>(trainRows.size()) > M)
+  vtkIdType maxRow = N - 1;
+  while (numberOfTrainRows > M)
   {
     rand->Next();
-    vtkIdType rec = static_cast<vtkIdType>(rand->GetRangeValue(0, N));
-    trainRows.erase(rec);
+    vtkIdType rec = static_cast<vtkIdType>(rand->GetRangeValue(0, maxRow));
+    if (trainRows[rec])
+    {
+      trainRows[rec] = false;
+      --numberOfTrainRows;
+    }
   }
-  while (static_cast<vtkIdType>(trainRows.size()) < M)
+  while (numberOfTrainRows < M)
   {
     rand->Next();
-    vtkIdType rec = static_cast<vtkIdType>(rand->GetRangeValue(0, N));
-    if (!ghosts || !ghosts->GetValue(rec))
+    vtkIdType rec = static_cast<vtkIdType>(rand->GetRangeValue(0, maxRow));
+    if ((!ghosts || !ghosts->GetValue(rec)) && !trainRows[rec])
+    {
+      trainRows[rec] = true;
+      ++numberOfTrainRows;
+    }
+  }
+
+  vtkNew<vtkIdList> srcIds;
+  srcIds->Allocate(M);
+  for (vtkIdType i = 0; i < N; ++i)
+  {
+    if (trainRows[i])
     {
-      trainRows.insert(rec);
+      srcIds->InsertNextId(i);
     }
   }
-  // Finally, copy the subset into the training table
+  vtkNew<vtkIdList> dstIds;
+  dstIds->SetNumberOfIds(M);
+  std::iota(dstIds->begin(), dstIds->end(), 0);
+
+  // Finally, copy the subset into the training table, one typed column at a
+  // time instead of going through a vtkVariantArray for every row.
   trainingTable->Initialize();
   for (int i = 0; i < fullDataTable->GetNumberOfColumns(); ++i)
   {
     vtkAbstractArray* srcCol = fullDataTable->GetColumn(i);
-    vtkAbstractArray* dstCol = vtkAbstractArray::CreateArray(srcCol->GetDataType());
+    vtkAbstractArray* dstCol = srcCol->NewInstance();
     dstCol->SetName(srcCol->GetName());
+    dstCol->SetNumberOfComponents(srcCol->GetNumberOfComponents());
+    dstCol->InsertTuples(dstIds, srcIds, srcCol);
     trainingTable->AddColumn(dstCol);
     dstCol->FastDelete();
   }
-  trainingTable->SetNumberOfRows(M);
-  vtkNew<vtkVariantArray> row;
-  vtkIdType dstRow = 0;
-  for (std::set<vtkIdType>::iterator it = trainRows.begin(); it != trainRows.end(); ++it, ++dstRow)
-  {
-    fullDataTable->GetRow(*it, row);
-    trainingTable->SetRow(dstRow, row);
-  }
   return 1;
 }
 
@@ -0,0 +1,53 @@
+# Tests that a file series read with prefetching enabled produces the same
+# data as without, whatever the direction and stride of playback.
+from paraview.simple import *
+from paraview import smtesting
+import os
+import shutil
+import sys
+
+smtesting.ProcessCommandLineArguments()
+
+path = os.path.join(smtesting.TempDir, 'FileSeriesPrefetch')
+if os.path.exists(path):
+    shutil.rmtree(path)
+os.makedirs(path)
+
+# write a series whose timesteps can be told apart by their number of points.
+resolutions = [8 + 2 * i for i in range(8)]
+fileNames = []
+sphere = Sphere()
+for i, resolution in enumerate(resolutions):
+    sphere.ThetaResolution = resolution
+    fileName = os.path.join(path, 'sphere_%d.vtp' % i)
+    SaveData(fileName, proxy=sphere)
+    fileNames.append(fileName)
+
+GetSettingsProxy('GeneralSettings').NumberOfFilesToPrefetch = 3
+
+reader = XMLPolyDataReader(FileName=fileNames)
+reader.UpdatePipelineInformation()
+times = reader.TimestepValues
+if len(times) != len(resolutions):
+    print("Expected %d timesteps, got %d" % (len(resolutions), len(times)))
+    sys.exit(1)
+
+expected = []
+for resolution in resolutions:
+    sphere.ThetaResolution = resolution
+    sphere.UpdatePipeline()
+    expected.append(sphere.GetDataInformation().GetNumberOfPoints())
+
+# forward, backward, with a stride and random access.
+order = list(range(len(times))) + list(reversed(range(len(times)))) + [0, 2, 4, 6, 1, 7, 3]
+for index in order:
+    reader.UpdatePipeline(times[index])
+    numPoints = reader.GetDataInformation().GetNumberOfPoints()
+    if numPoints != expected[index]:
+        print("Timestep %d: expected %d points, got %d" % (index, expected[index], numPoints))
+        sys.exit(1)
+
+Delete(reader)
+GetSettingsProxy('GeneralSettings').NumberOfFilesToPrefetch = 0
+shutil.rmtree(path)
+print("success")
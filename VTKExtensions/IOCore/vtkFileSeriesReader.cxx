@@ -34,6 +34,7 @@
 #include "vtkInformationVector.h"
 #include "vtkLogger.h"
 #include "vtkMath.h"
+#include "vtkMultiProcessController.h"
 #include "vtkObjectFactory.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringArray.h"
@@ -46,10 +47,17 @@
 #define VTK_CREATE(type, name) vtkSmartPointer<type> name = vtkSmartPointer<type>::New()
 
 #include <algorithm>
+#include <atomic>
 #include <cctype> // for isprint().
+#include <cstdlib>
+#include <condition_variable>
+#include <deque>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "vtk_jsoncpp.h"
@@ -380,6 +388,104 @@ private:
 };
 }
 
+//=============================================================================
+// Reads files on a background thread to warm up the OS file cache for the
+// timesteps expected to be requested next. Pending files are replaced on each
+// `Prefetch` call, so a change of direction never waits on stale reads.
+namespace
+{
+class vtkFileSeriesReaderPrefetcher
+{
+public:
+  ~vtkFileSeriesReaderPrefetcher()
+  {
+    if (this->Thread.joinable())
+    {
+      {
+        std::lock_guard<std::mutex> lock(this->Mutex);
+        this->Terminate = true;
+        this->Pending.clear();
+      }
+      ++this->Generation;
+      this->Condition.notify_all();
+      this->Thread.join();
+    }
+  }
+
+  void Prefetch(const std::vector<std::string>& files)
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->Mutex);
+      this->Pending.clear();
+      for (const auto& fname : files)
+      {
+        if (std::find(this->Recent.begin(), this->Recent.end(), fname) == this->Recent.end())
+        {
+          this->Pending.push_back(fname);
+        }
+      }
+      if (!this->Thread.joinable())
+      {
+        this->Thread = std::thread(&vtkFileSeriesReaderPrefetcher::Run, this);
+      }
+    }
+    ++this->Generation;
+    this->Condition.notify_all();
+  }
+
+private:
+  void Run()
+  {
+    std::vector<char> buffer(1 << 20);
+    std::unique_lock<std::mutex> lock(this->Mutex);
+    while (true)
+    {
+      this->Condition.wait(lock, [this]() { return this->Terminate || !this->Pending.empty(); });
+      if (this->Terminate)
+      {
+        break;
+      }
+
+      const std::string fname = this->Pending.front();
+      this->Pending.pop_front();
+      this->Recent.push_back(fname);
+      while (this->Recent.size() > RecentSize)
+      {
+        this->Recent.pop_front();
+      }
+      const unsigned int generation = this->Generation;
+      lock.unlock();
+
+      if (!vtksys::SystemTools::FileIsDirectory(fname))
+      {
+        vtksys::ifstream file(fname.c_str(), std::ios::in | std::ios::binary);
+        // stop as soon as new files have been requested; they are more
+        // relevant than the rest of this one.
+        while (file && generation == this->Generation)
+        {
+          file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        }
+      }
+
+      lock.lock();
+    }
+  }
+
+  // files prefetched recently are not read again.
+  static constexpr size_t RecentSize = 64;
+
+  std::thread Thread;
+  std::mutex Mutex;
+  std::condition_variable Condition;
+  std::deque<std::string> Pending;
+  std::deque<std::string> Recent;
+  std::atomic<unsigned int> Generation{ 0 };
+  bool Terminate = false;
+};
+
+int vtkFileSeriesReaderNumberOfFilesToPrefetch = 0;
+}
+
 //=============================================================================
 struct vtkFileSeriesReaderInternals
 {
@@ -388,6 +494,10 @@ struct vtkFileSeriesReaderInternals
   std::vector<double> TimeValues;
   bool FileNameIsSet;
   vtkFileSeriesReaderTimeRanges* TimeRanges;
+
+  // used to predict the files to prefetch.
+  int LastReadIndex = -1;
+  std::unique_ptr<vtkFileSeriesReaderPrefetcher> Prefetcher;
 };
 
 //=============================================================================
@@ -738,11 +848,75 @@ int vtkFileSeriesReader::RequestData(
   {
     // Now restore the information.
     this->Internal->TimeRanges->GetAggregateTimeInfo(outInfo);
+    this->PrefetchFiles();
   }
 
   return retVal;
 }
 
+//-----------------------------------------------------------------------------
+void vtkFileSeriesReader::PrefetchFiles()
+{
+  const int current = this->_FileIndex;
+  const int previous = this->Internal->LastReadIndex;
+  this->Internal->LastReadIndex = current;
+
+  // all ranks read the same files. The file cache is shared by the ranks of a
+  // node and parallel file systems serve all nodes from the same storage, so
+  // prefetching on every rank would only multiply the I/O by the number of
+  // ranks. Prefetch on the root rank alone.
+  auto controller = vtkMultiProcessController::GetGlobalController();
+  if (controller && controller->GetLocalProcessId() != 0)
+  {
+    return;
+  }
+
+  const int count = vtkFileSeriesReader::GetNumberOfFilesToPrefetch();
+  const int numFiles = static_cast<int>(this->GetNumberOfFileNames());
+  if (count <= 0 || numFiles < 2 || current < 0 || current >= numFiles)
+  {
+    return;
+  }
+
+  // follow the direction and stride of the last step. Large jumps are assumed
+  // to be random access, in which case we simply expect playback to continue
+  // forward.
+  int stride = 1;
+  if (previous >= 0 && previous != current && std::abs(current - previous) <= count)
+  {
+    stride = current - previous;
+  }
+
+  std::vector<std::string> files;
+  for (int cc = 1; cc <= std::min(count, numFiles - 1); ++cc)
+  {
+    // animations loop, so wrap around at either end.
+    const int index = (((current + cc * stride) % numFiles) + numFiles) % numFiles;
+    if (index != current)
+    {
+      files.emplace_back(this->GetFileName(static_cast<unsigned int>(index)));
+    }
+  }
+
+  if (!this->Internal->Prefetcher)
+  {
+    this->Internal->Prefetcher.reset(new vtkFileSeriesReaderPrefetcher());
+  }
+  this->Internal->Prefetcher->Prefetch(files);
+}
+
+//-----------------------------------------------------------------------------
+void vtkFileSeriesReader::SetNumberOfFilesToPrefetch(int count)
+{
+  vtkFileSeriesReaderNumberOfFilesToPrefetch = std::max(count, 0);
+}
+
+//-----------------------------------------------------------------------------
+int vtkFileSeriesReader::GetNumberOfFilesToPrefetch()
+{
+  return vtkFileSeriesReaderNumberOfFilesToPrefetch;
+}
+
 //-----------------------------------------------------------------------------
 int vtkFileSeriesReader::RequestInformationForInput(
   int index, vtkInformation* request, vtkInformationVector* outputVector)
@@ -75,6 +75,15 @@
  * with SetMetaFileName in this case. Do not use the AddFileName() method when
  * using SetMetaFileName() as names set with AddFileName() will be ignored.
  *
+ * To avoid stalling on I/O when playing an animation, vtkFileSeriesReader can
+ * prefetch the files for the timesteps that are expected to be requested next
+ * (see `SetNumberOfFilesToPrefetch`). The direction and stride are predicted
+ * from the last two files read. Files are read on a background thread to
+ * warm up the operating system's file cache; the internal reader still
+ * reads the file itself when the timestep is requested. In parallel, only the
+ * root rank prefetches. Only the files of the series are read ahead: pieces
+ * referenced by these files (e.g. the pieces of a .pvtu or .pvti file) are not.
+ *
 */
 
 #ifndef vtkFileSeriesReader_h
@@ -153,6 +162,16 @@ public:
   vtkBooleanMacro(IgnoreReaderTime, bool);
   ///@}
 
+  ///@{
+  /**
+   * Number of files to prefetch on a background thread after a file has been
+   * read. This applies to all instances. 0 (default) disables prefetching.
+   * Only the root rank of the global controller prefetches.
+   */
+  static void SetNumberOfFilesToPrefetch(int count);
+  static int GetNumberOfFilesToPrefetch();
+  ///@}
+
   // Expose number of files, first filename and current file number as
   // information keys for potential use in the internal reader
   static vtkInformationIntegerKey* FILE_SERIES_NUMBER_OF_FILES();
@@ -235,6 +254,12 @@ protected:
 
   int ChooseInput(vtkInformation*);
 
+  /**
+   * Predicts the files to be read next from the files read so far and
+   * schedules them for prefetching. Called after each file is read.
+   */
+  void PrefetchFiles();
+
 private:
   vtkFileSeriesReader(const vtkFileSeriesReader&) = delete;
   void operator=(const vtkFileSeriesReader&) = delete;
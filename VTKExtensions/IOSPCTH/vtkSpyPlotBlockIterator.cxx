@@ -1,5 +1,7 @@
 #include "vtkSpyPlotBlockIterator.h"
 #include "vtkSpyPlotReader.h"
+
+#include <algorithm>
 #include <cassert>
 
 vtkSpyPlotBlockIterator::vtkSpyPlotBlockIterator()
@@ -252,3 +254,101 @@ void vtkSpyPlotFileDistributionBlockIterator::FindFirstBlockOfCurrentOrNextFile(
     this->Active = this->FileIndex <= this->FileEnd;
   }
 }
+
+void vtkSpyPlotCellDistributionBlockIterator::SetBlockIndex(
+  const std::vector<std::vector<vtkIdType>>* index)
+{
+  this->BlockIndex = index;
+}
+
+void vtkSpyPlotCellDistributionBlockIterator::Init(int numberOfProcessors, int processorId,
+  vtkSpyPlotReader* parent, vtkSpyPlotReaderMap* fileMap, int currentTimeStep)
+{
+  assert("pre: index_exists" && this->BlockIndex != nullptr);
+  vtkSpyPlotBlockIterator::Init(numberOfProcessors, processorId, parent, fileMap, currentTimeStep);
+
+  const int numFiles = std::min(this->NumberOfFiles, static_cast<int>(this->BlockIndex->size()));
+  this->BlockRanges.assign(this->NumberOfFiles, std::make_pair(0, -1));
+
+  // Empty blocks still cost something to process, count at least one cell
+  // for each of them.
+  double totalCells = 0;
+  for (int file = 0; file < numFiles; ++file)
+  {
+    for (vtkIdType cells : (*this->BlockIndex)[file])
+    {
+      totalCells += std::max<vtkIdType>(cells, 1);
+    }
+  }
+
+  // A block goes to the processor whose share of the cells contains the
+  // middle of the block. Shares are contiguous, so are the blocks of a file
+  // assigned to a processor.
+  double cellsBefore = 0;
+  for (int file = 0; file < numFiles; ++file)
+  {
+    const std::vector<vtkIdType>& cellsPerBlock = (*this->BlockIndex)[file];
+    std::pair<int, int>& range = this->BlockRanges[file];
+    for (int block = 0; block < static_cast<int>(cellsPerBlock.size()); ++block)
+    {
+      const double cells = static_cast<double>(std::max<vtkIdType>(cellsPerBlock[block], 1));
+      const int owner = std::min(this->NumberOfProcessors - 1,
+        static_cast<int>((cellsBefore + 0.5 * cells) * this->NumberOfProcessors / totalCells));
+      cellsBefore += cells;
+      if (owner == this->ProcessorId)
+      {
+        if (range.first > range.second)
+        {
+          range.first = block;
+        }
+        range.second = block;
+      }
+    }
+  }
+}
+
+void vtkSpyPlotCellDistributionBlockIterator::Start()
+{
+  this->FileIterator = this->FileMap->Files.begin();
+  this->FileIndex = 0;
+  this->FindFirstBlockOfCurrentOrNextFile();
+}
+
+int vtkSpyPlotCellDistributionBlockIterator::GetNumberOfBlocksToProcess()
+{
+  // No file needs to be opened: the block index tells how many blocks each
+  // file has.
+  int total_num_blocks = 0;
+  for (const auto& range : this->BlockRanges)
+  {
+    total_num_blocks += std::max(range.second - range.first + 1, 0);
+  }
+  return total_num_blocks;
+}
+
+void vtkSpyPlotCellDistributionBlockIterator::FindFirstBlockOfCurrentOrNextFile()
+{
+  this->Active = this->FileIndex < this->NumberOfFiles;
+  while (this->Active)
+  {
+    const std::pair<int, int>& range = this->BlockRanges[this->FileIndex];
+    if (range.first <= range.second)
+    {
+      const char* fname = this->FileIterator->first.c_str();
+      this->UniReader = this->FileMap->GetReader(this->FileIterator, this->Parent);
+      this->UniReader->SetFileName(fname);
+      this->UniReader->ReadInformation();
+
+      if (this->UniReader->SetCurrentTimeStep(this->CurrentTimeStep))
+      {
+        this->NumberOfFields = this->UniReader->GetNumberOfCellFields();
+        this->Block = range.first;
+        this->BlockEnd = range.second;
+        break;
+      }
+    }
+    ++this->FileIterator;
+    ++this->FileIndex;
+    this->Active = this->FileIndex < this->NumberOfFiles;
+  }
+}
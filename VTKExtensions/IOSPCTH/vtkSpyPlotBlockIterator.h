@@ -6,6 +6,8 @@
 #include "vtkSpyPlotUniReader.h"             // for vtkSpyPlotUniReader
 
 #include <cassert> // for assert
+#include <utility> // for std::pair
+#include <vector>  // for std::vector
 
 class vtkSpyPlotReader;
 
@@ -121,6 +123,36 @@ protected:
   int FileEnd;
 };
 
+// Distributes the blocks of all the files over processors so that each one
+// gets about the same number of cells. Each processor reads contiguous blocks,
+// so it only opens the files holding its blocks.
+class VTKPVVTKEXTENSIONSIOSPCTH_EXPORT vtkSpyPlotCellDistributionBlockIterator
+  : public vtkSpyPlotBlockIterator
+{
+public:
+  vtkSpyPlotCellDistributionBlockIterator() = default;
+  ~vtkSpyPlotCellDistributionBlockIterator() override = default;
+
+  // Description:
+  // Set the number of cells of each block of each file, in the order of the
+  // file map, at the time step to iterate over. Files that do not have the
+  // time step have no blocks. Must be called before Init().
+  void SetBlockIndex(const std::vector<std::vector<vtkIdType>>* index);
+
+  void Init(int numberOfProcessors, int processorId, vtkSpyPlotReader* parent,
+    vtkSpyPlotReaderMap* fileMap, int currentTimeStep) override;
+  void Start() override;
+  int GetNumberOfBlocksToProcess() override;
+
+protected:
+  void FindFirstBlockOfCurrentOrNextFile() override;
+
+  const std::vector<std::vector<vtkIdType>>* BlockIndex = nullptr;
+  // First and last block assigned to this processor in each file. The range
+  // is empty (first > last) for files this processor does not read.
+  std::vector<std::pair<int, int>> BlockRanges;
+};
+
 inline void vtkSpyPlotBlockIterator::Next()
 {
   assert("pre: is_active" && IsActive());
@@ -78,6 +78,10 @@ class vtkSpyPlotReader::VectorOfDoubles : public std::vector<double>
 {
 };
 
+class vtkSpyPlotReader::BlockIndexMap : public std::map<int, std::vector<std::vector<vtkIdType>>>
+{
+};
+
 //-----------------------------------------------------------------------------
 vtkSpyPlotReader::vtkSpyPlotReader()
 {
@@ -106,6 +110,7 @@ vtkSpyPlotReader::vtkSpyPlotReader()
   this->SetGlobalController(vtkMultiProcessController::GetGlobalController());
 
   this->DistributeFiles = 0;          // by default, distribute blocks, not files.
+  this->DistributeBlocksByCellCount = 0;
   this->GenerateLevelArray = 0;       // by default, do not generate level array.
   this->GenerateBlockIdArray = 0;     // by default, do not generate block id array.
   this->GenerateActiveBlockArray = 0; // by default do not generate active array
@@ -114,6 +119,7 @@ vtkSpyPlotReader::vtkSpyPlotReader()
   this->IsAMR = 1;
   this->FileNameChanged = true;
   this->TimeSteps = new vtkSpyPlotReader::VectorOfDoubles();
+  this->BlockIndex = new vtkSpyPlotReader::BlockIndexMap();
   this->TimeRequestedFromPipeline = false;
 }
 
@@ -128,6 +134,7 @@ vtkSpyPlotReader::~vtkSpyPlotReader()
   this->Map = nullptr;
   this->SetGlobalController(nullptr);
   delete this->TimeSteps;
+  delete this->BlockIndex;
 }
 
 //-----------------------------------------------------------------------------
@@ -309,6 +316,7 @@ int vtkSpyPlotReader::UpdateFile(vtkInformation* request, vtkInformationVector*
   }
 
   this->FileNameChanged = false;
+  this->BlockIndex->clear();
 
   const int procId = this->GlobalController ? this->GlobalController->GetLocalProcessId() : 0;
   const int numProcs = this->GlobalController ? this->GlobalController->GetNumberOfProcesses() : 1;
@@ -337,6 +345,71 @@ int vtkSpyPlotReader::UpdateFile(vtkInformation* request, vtkInformationVector*
   return this->Map->Files.empty() ? 0 : this->UpdateMetaData(request, outputVector);
 }
 
+//-----------------------------------------------------------------------------
+const std::vector<std::vector<vtkIdType>>* vtkSpyPlotReader::GetBlockIndex(int timeStep)
+{
+  auto iter = this->BlockIndex->find(timeStep);
+  if (iter != this->BlockIndex->end())
+  {
+    return &iter->second;
+  }
+
+  const int procId = this->GlobalController ? this->GlobalController->GetLocalProcessId() : 0;
+  const int numProcs = this->GlobalController ? this->GlobalController->GetNumberOfProcesses() : 1;
+
+  // Only the first process reads the block definitions of all the files, the
+  // others get them from it (as for the meta-data, see UpdateMetaData).
+  std::vector<std::vector<vtkIdType>>& index = (*this->BlockIndex)[timeStep];
+  index.resize(this->Map->Files.size());
+  if (procId == 0)
+  {
+    size_t file = 0;
+    for (auto fileIter = this->Map->Files.begin(); fileIter != this->Map->Files.end();
+         ++fileIter, ++file)
+    {
+      vtkSpyPlotUniReader* uniReader = this->Map->GetReader(fileIter, this);
+      uniReader->ReadInformation();
+      if (uniReader->SetCurrentTimeStep(timeStep))
+      {
+        uniReader->GetBlockCellCounts(index[file]);
+      }
+    }
+  }
+
+  if (numProcs > 1)
+  {
+    vtkMultiProcessStream stream;
+    if (procId == 0)
+    {
+      for (const auto& cellsPerBlock : index)
+      {
+        stream << static_cast<int>(cellsPerBlock.size());
+        for (vtkIdType cells : cellsPerBlock)
+        {
+          stream << static_cast<vtkTypeInt64>(cells);
+        }
+      }
+    }
+    this->GlobalController->Broadcast(stream, 0);
+    if (procId > 0)
+    {
+      for (auto& cellsPerBlock : index)
+      {
+        int numBlocks;
+        stream >> numBlocks;
+        cellsPerBlock.resize(numBlocks);
+        for (int cc = 0; cc < numBlocks; ++cc)
+        {
+          vtkTypeInt64 cells;
+          stream >> cells;
+          cellsPerBlock[cc] = static_cast<vtkIdType>(cells);
+        }
+      }
+    }
+  }
+  return &index;
+}
+
 //-----------------------------------------------------------------------------
 int vtkSpyPlotReader::UpdateMetaData(
   vtkInformation* vtkNotUsed(request), vtkInformationVector* vtkNotUsed(outputVector))
@@ -669,7 +742,15 @@ int vtkSpyPlotReader::RequestData(vtkInformation* request,
 
   vtkSpyPlotBlock* block;
   vtkSpyPlotBlockIterator* blockIterator;
-  if (this->DistributeFiles)
+  if (this->DistributeBlocksByCellCount)
+  {
+    vtkDebugMacro("Distribute blocks by cell count");
+    vtkSpyPlotCellDistributionBlockIterator* cellIterator =
+      new vtkSpyPlotCellDistributionBlockIterator;
+    cellIterator->SetBlockIndex(this->GetBlockIndex(this->CurrentTimeStep));
+    blockIterator = cellIterator;
+  }
+  else if (this->DistributeFiles)
   {
     vtkDebugMacro("Distribute files");
     blockIterator = new vtkSpyPlotFileDistributionBlockIterator;
@@ -1413,6 +1494,16 @@ void vtkSpyPlotReader::PrintSelf(ostream& os, vtkIndent indent)
     os << "false" << endl;
   }
 
+  os << "DistributeBlocksByCellCount: ";
+  if (this->DistributeBlocksByCellCount)
+  {
+    os << "true" << endl;
+  }
+  else
+  {
+    os << "false" << endl;
+  }
+
   os << "DownConvertVolumeFraction: ";
   if (this->DownConvertVolumeFraction)
   {
@@ -40,6 +40,13 @@ PURPOSE.  See the above copyright notice for more information.
  * - or by distributing files: a file is read entirely by one processor. If
  * there is only one file, all the other processors are not used at all.
  *
+ * Alternatively (controlled by SetDistributeBlocksByCellCount() ), the blocks
+ * of all the files are distributed so that each processor gets about the same
+ * number of cells. The number of cells of each block is read once per time
+ * step by the first processor and broadcast to the others. Each processor only
+ * reads the files holding its blocks, which balances well series made of a few
+ * large files and many small ones.
+ *
  * @par Implementation Details:
  * - All processors read the first binary file listed in the case file to get
  * information about the fields.
@@ -55,6 +62,8 @@ PURPOSE.  See the above copyright notice for more information.
 #include "vtkCompositeDataSetAlgorithm.h"
 #include "vtkPVVTKExtensionsIOSPCTHModule.h" //needed for exports
 
+#include <vector> // for std::vector
+
 class vtkBoundingBox;
 class vtkCallbackCommand;
 class vtkCellData;
@@ -110,6 +119,17 @@ public:
   vtkBooleanMacro(DistributeFiles, int);
   ///@}
 
+  ///@{
+  /**
+   * If true, the reader distributes the blocks of all the files over
+   * processors balancing the number of cells each processor reads. Takes
+   * precedence over DistributeFiles. Default is false.
+   */
+  vtkSetMacro(DistributeBlocksByCellCount, int);
+  vtkGetMacro(DistributeBlocksByCellCount, int);
+  vtkBooleanMacro(DistributeBlocksByCellCount, int);
+  ///@}
+
   ///@{
   /**
    * If true, the reader generate a cell array in each block that
@@ -373,6 +393,7 @@ protected:
   vtkSpyPlotReaderMap* Map;
 
   int DistributeFiles;
+  int DistributeBlocksByCellCount;
 
   vtkBoundingBox* Bounds;    // bounds of the hierarchy without the bad ghostcells.
   int BoxSize[3];            // size of boxes if they are all the same, else -1,-1,-1
@@ -402,6 +423,12 @@ private:
 
   VectorOfDoubles* TimeSteps;
   void SetTimeStepsInternal(const VectorOfDoubles&);
+
+  // Number of cells of each block of each file, per time step. Built on the
+  // first processor and broadcast, kept until the file name changes.
+  class BlockIndexMap;
+  BlockIndexMap* BlockIndex;
+  const std::vector<std::vector<vtkIdType>>* GetBlockIndex(int timeStep);
 };
 
 #endif
@@ -5,6 +5,7 @@
 #include "vtkFloatArray.h"
 #include "vtkIntArray.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 #include "vtkSpyPlotBlock.h"
 #include "vtkSpyPlotIStream.h"
 #include "vtkUnsignedCharArray.h"
@@ -12,7 +13,9 @@
 #include "vtksys/FStream.hxx"
 #include "vtksys/RegularExpression.hxx"
 
+#include <atomic>
 #include <sstream>
+#include <utility>
 #include <vector>
 
 //=============================================================================
@@ -41,6 +44,17 @@ inline ostream& operator<<(ostream& os, const vtkSpyPlotWriteString& c)
   return os;
 }
 
+// A run-length encoded plane of a cell field read from the file and the
+// location where it has to be decoded.
+struct vtkSpyPlotEncodedPlane
+{
+  size_t Offset;
+  int Size;
+  float* FloatData;
+  unsigned char* UnsignedCharData;
+  int NumberOfValues;
+};
+
 //-----------------------------------------------------------------------------
 vtkSpyPlotUniReader::vtkSpyPlotUniReader()
 {
@@ -393,6 +407,21 @@ int vtkSpyPlotUniReader::MakeCurrent()
     int numBytes;
     int block;
     int actualBlockId = 0;
+    std::vector<unsigned char> variableBuffer;
+    std::vector<vtkSpyPlotEncodedPlane> planes;
+    // arrays created for the blocks, stored in the variable only once all of
+    // them have been decoded successfully.
+    std::vector<std::pair<int, vtkDataArray*>> newDataBlocks;
+    auto discardVariable = [&]() {
+      for (auto& newDataBlock : newDataBlocks)
+      {
+        newDataBlock.second->Delete();
+      }
+      delete[] var->DataBlocks;
+      var->DataBlocks = nullptr;
+      delete[] var->GhostCellsFixed;
+      var->GhostCellsFixed = nullptr;
+    };
     for (block = 0; block < dp->NumberOfBlocks; ++block)
     {
       vtkSpyPlotBlock* bk = this->Blocks + block;
@@ -417,6 +446,7 @@ int vtkSpyPlotUniReader::MakeCurrent()
           dataArray->SetNumberOfTuples(
             bk->GetDimension(0) * bk->GetDimension(1) * bk->GetDimension(2));
           dataArray->SetName(var->Name);
+          newDataBlocks.emplace_back(actualBlockId, dataArray);
           // vtkDebugMacro( "*** Create data array: "
           // << dataArray->GetNumberOfTuples() );
         }
@@ -429,45 +459,78 @@ int vtkSpyPlotUniReader::MakeCurrent()
           if (!spis.ReadInt32s(&numBytes, 1))
           {
             vtkErrorMacro("Problem reading the number of bytes");
+            discardVariable();
             return 0;
           }
-          if (static_cast<int>(arrayBuffer.size()) < numBytes)
-          {
-            arrayBuffer.resize(numBytes);
-          }
-          if (!spis.ReadString(&*arrayBuffer.begin(), numBytes))
-          {
-            vtkErrorMacro("Problem reading the bytes");
-            return 0;
-          }
-          if (floatArray)
+          if (!dataArray)
           {
-            float* ptr = floatArray->GetPointer(zax * planeSize);
-            if (!this->RunLengthDataDecode(&*arrayBuffer.begin(), numBytes, ptr, planeSize))
+            if (static_cast<int>(arrayBuffer.size()) < numBytes)
             {
-              vtkErrorMacro("Problem RLD decoding float data array");
-              return 0;
+              arrayBuffer.resize(numBytes);
             }
-          }
-          if (unsignedCharArray)
-          {
-            unsigned char* ptr = unsignedCharArray->GetPointer(zax * planeSize);
-            if (!this->RunLengthDataDecode(&*arrayBuffer.begin(), numBytes, ptr, planeSize))
+            if (!spis.ReadString(&*arrayBuffer.begin(), numBytes))
             {
-              vtkErrorMacro("Problem RLD decoding unsigned char data array");
+              vtkErrorMacro("Problem reading the bytes");
+              discardVariable();
               return 0;
             }
+            continue;
+          }
+          // Only read the encoded plane here, decoding happens once all the
+          // planes of the variable are read.
+          vtkSpyPlotEncodedPlane plane;
+          plane.Offset = variableBuffer.size();
+          plane.Size = numBytes;
+          plane.FloatData = floatArray ? floatArray->GetPointer(zax * planeSize) : nullptr;
+          plane.UnsignedCharData =
+            unsignedCharArray ? unsignedCharArray->GetPointer(zax * planeSize) : nullptr;
+          plane.NumberOfValues = planeSize;
+          variableBuffer.resize(plane.Offset + numBytes);
+          if (numBytes > 0 && !spis.ReadString(&variableBuffer[plane.Offset], numBytes))
+          {
+            vtkErrorMacro("Problem reading the bytes");
+            discardVariable();
+            return 0;
           }
+          planes.push_back(plane);
         }
         if (dataArray)
         {
-          var->DataBlocks[actualBlockId] = dataArray;
-          var->GhostCellsFixed[actualBlockId] = 0;
-          vtkDebugMacro(" " << dataArray << " initialized: " << dataArray->GetName());
           actualBlockId++;
         }
       }
     }
+
+    // Planes are independent, decode them concurrently.
+    std::atomic<bool> decoded(true);
+    vtkSMPTools::For(0, static_cast<vtkIdType>(planes.size()), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType cc = begin; cc < end && decoded; ++cc)
+      {
+        const vtkSpyPlotEncodedPlane& plane = planes[cc];
+        const unsigned char* in = variableBuffer.data() + plane.Offset;
+        int status = plane.FloatData
+          ? this->RunLengthDataDecode(in, plane.Size, plane.FloatData, plane.NumberOfValues)
+          : this->RunLengthDataDecode(in, plane.Size, plane.UnsignedCharData, plane.NumberOfValues);
+        if (!status)
+        {
+          decoded = false;
+        }
+      }
+    });
+    if (!decoded)
+    {
+      vtkErrorMacro("Problem RLD decoding data array: " << var->Name);
+      discardVariable();
+      return 0;
+    }
+
+    for (auto& newDataBlock : newDataBlocks)
+    {
+      var->DataBlocks[newDataBlock.first] = newDataBlock.second;
+      var->GhostCellsFixed[newDataBlock.first] = 0;
+      vtkDebugMacro(
+        " " << newDataBlock.second << " initialized: " << newDataBlock.second->GetName());
+    }
   }
 
   if (blocksUpdated && needMarkers)
@@ -843,6 +906,55 @@ double vtkSpyPlotUniReader::GetTimeFromTimeStep(int timeStep)
   return this->DumpTime[timeStep];
 }
 
+//-----------------------------------------------------------------------------
+int vtkSpyPlotUniReader::GetBlockCellCounts(std::vector<vtkIdType>& counts)
+{
+  counts.clear();
+  if (!this->HaveInformation && !this->ReadInformation())
+  {
+    return 0;
+  }
+
+  vtkSpyPlotUniReader::DataDump* dp = this->DataDumps + this->CurrentTimeStep;
+  counts.reserve(dp->ActualNumberOfBlocks);
+  if (this->GeomTimeStep == this->CurrentTimeStep)
+  {
+    for (int block = 0; block < dp->NumberOfBlocks; ++block)
+    {
+      vtkSpyPlotBlock* bk = this->Blocks + block;
+      if (bk->IsAllocated())
+      {
+        counts.push_back(static_cast<vtkIdType>(bk->GetDimension(0)) * bk->GetDimension(1) *
+          bk->GetDimension(2));
+      }
+    }
+    return 1;
+  }
+
+  // Only parse the block definitions: dimensions and allocation state are the
+  // first values of each of them (see vtkSpyPlotBlock::Read).
+  vtksys::ifstream ifs(this->FileName, ios::binary | ios::in);
+  vtkSpyPlotIStream spis;
+  spis.SetStream(&ifs);
+  spis.Seek(dp->BlocksOffset);
+  const int blockSize = this->FileVersion >= 103 ? 12 : 6;
+  int values[12];
+  for (int block = 0; block < dp->NumberOfBlocks; ++block)
+  {
+    if (!spis.ReadInt32s(values, blockSize))
+    {
+      vtkErrorMacro("Problem reading the block information");
+      counts.clear();
+      return 0;
+    }
+    if (values[3])
+    {
+      counts.push_back(static_cast<vtkIdType>(values[0]) * values[1] * values[2]);
+    }
+  }
+  return 1;
+}
+
 //-----------------------------------------------------------------------------
 int vtkSpyPlotUniReader::GetNumberOfDataBlocks()
 {
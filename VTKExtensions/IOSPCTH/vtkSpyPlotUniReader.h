@@ -36,6 +36,9 @@ PURPOSE.  See the above copyright notice for more information.
 
 #include "vtkObject.h"
 #include "vtkPVVTKExtensionsIOSPCTHModule.h" //needed for exports
+
+#include <vector> // for std::vector
+
 class vtkSpyPlotBlock;
 class vtkDataArraySelection;
 class vtkDataArray;
@@ -123,6 +126,13 @@ public:
    */
   int GetNumberOfDataBlocks();
 
+  /**
+   * Fills counts with the number of cells of each allocated block at the
+   * current time step. Only the block definitions are read from the file, the
+   * fields and the geometry are left untouched. Returns 0 on failure.
+   */
+  int GetBlockCellCounts(std::vector<vtkIdType>& counts);
+
   /**
    * Return the name of the ith field
    */
@@ -0,0 +1,192 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestReductionFilterTree.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+#include "vtkAttributeDataReductionFilter.h"
+#include "vtkDoubleArray.h"
+#include "vtkIntArray.h"
+#include "vtkMPIController.h"
+#include "vtkNew.h"
+#include "vtkPVMergeTables.h"
+#include "vtkReductionFilter.h"
+#include "vtkSmartPointer.h"
+#include "vtkTable.h"
+#include "vtkVariant.h"
+
+#include <initializer_list>
+#include <iostream>
+
+namespace
+{
+// Each rank contributes a different number of rows, rank 1 none at all, so that
+// merging the tables in another order than the process order would show.
+vtkSmartPointer<vtkTable> MakeMergeInput(int rank)
+{
+  vtkNew<vtkIntArray> ranks;
+  ranks->SetName("Rank");
+  vtkNew<vtkDoubleArray> values;
+  values->SetName("Value");
+  const int numRows = rank == 1 ? 0 : rank + 1;
+  for (int cc = 0; cc < numRows; ++cc)
+  {
+    ranks->InsertNextValue(rank);
+    values->InsertNextValue(100.0 * rank + cc);
+  }
+  auto table = vtkSmartPointer<vtkTable>::New();
+  table->AddColumn(ranks);
+  table->AddColumn(values);
+  return table;
+}
+
+// A histogram-like table: the same bins on all ranks, with rank specific counts.
+vtkSmartPointer<vtkTable> MakeSumInput(int rank)
+{
+  vtkNew<vtkDoubleArray> counts;
+  counts->SetName("Counts");
+  for (int cc = 0; cc < 5; ++cc)
+  {
+    counts->InsertNextValue((rank + 1) * (cc + 1));
+  }
+  auto table = vtkSmartPointer<vtkTable>::New();
+  table->AddColumn(counts);
+  return table;
+}
+
+vtkSmartPointer<vtkTable> Reduce(vtkMultiProcessController* controller, vtkTable* input,
+  vtkAlgorithm* helper, int fanIn, int mode, int reductionProcessId)
+{
+  vtkNew<vtkReductionFilter> reducer;
+  reducer->SetController(controller);
+  reducer->SetPostGatherHelper(helper);
+  reducer->SetTreeReductionFanIn(fanIn);
+  reducer->SetReductionMode(mode);
+  reducer->SetReductionProcessId(reductionProcessId);
+  reducer->SetInputData(input);
+  reducer->Update();
+
+  auto result = vtkSmartPointer<vtkTable>::New();
+  result->DeepCopy(vtkTable::SafeDownCast(reducer->GetOutputDataObject(0)));
+  return result;
+}
+
+bool SameTables(vtkTable* expected, vtkTable* actual)
+{
+  if (expected->GetNumberOfColumns() != actual->GetNumberOfColumns() ||
+    expected->GetNumberOfRows() != actual->GetNumberOfRows())
+  {
+    return false;
+  }
+  for (vtkIdType row = 0; row < expected->GetNumberOfRows(); ++row)
+  {
+    for (vtkIdType col = 0; col < expected->GetNumberOfColumns(); ++col)
+    {
+      if (expected->GetValue(row, col).ToDouble() != actual->GetValue(row, col).ToDouble())
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Compare the tree reduction against the gather-based one for all fan-ins and
+// reduction modes, on the processes that hold the reduced result.
+bool CompareTreeToFlat(
+  vtkMultiProcessController* controller, vtkTable* input, vtkAlgorithm* helper, const char* label)
+{
+  const int rank = controller->GetLocalProcessId();
+  const int numProcs = controller->GetNumberOfProcesses();
+  const int targets[] = { 0, numProcs - 1 };
+  const int modes[] = { vtkReductionFilter::REDUCE_ALL_TO_ONE,
+    vtkReductionFilter::REDUCE_ALL_TO_ALL };
+
+  bool success = true;
+  for (int mode : modes)
+  {
+    for (int target : targets)
+    {
+      auto flat = Reduce(controller, input, helper, 0, mode, target);
+      for (int fanIn : { 2, 3, numProcs })
+      {
+        auto tree = Reduce(controller, input, helper, fanIn, mode, target);
+        const bool holdsResult = mode == vtkReductionFilter::REDUCE_ALL_TO_ALL || rank == target;
+        if (holdsResult && !SameTables(flat, tree))
+        {
+          std::cerr << "ERROR: " << label << ": tree reduction with fan-in " << fanIn
+                    << " to process " << target << " (mode " << mode
+                    << ") does not match the gather-based reduction on rank " << rank << endl;
+          success = false;
+        }
+      }
+    }
+  }
+  return success;
+}
+}
+
+int TestReductionFilterTree(int argc, char* argv[])
+{
+  vtkNew<vtkMPIController> controller;
+  controller->Initialize(&argc, &argv, 0);
+  vtkMultiProcessController::SetGlobalController(controller);
+
+  const int rank = controller->GetLocalProcessId();
+  const int numProcs = controller->GetNumberOfProcesses();
+  int success = 1;
+
+  vtkNew<vtkPVMergeTables> merge;
+  if (!vtkReductionFilter::IsAssociativePostGatherHelper(merge))
+  {
+    std::cerr << "ERROR: vtkPVMergeTables is not registered as associative." << endl;
+    success = 0;
+  }
+  auto mergeInput = MakeMergeInput(rank);
+  success &= CompareTreeToFlat(controller, mergeInput, merge, "vtkPVMergeTables") ? 1 : 0;
+
+  vtkNew<vtkAttributeDataReductionFilter> sum;
+  sum->SetAttributeType(vtkAttributeDataReductionFilter::ROW_DATA);
+  sum->SetReductionType(vtkAttributeDataReductionFilter::ADD);
+  if (!vtkReductionFilter::IsAssociativePostGatherHelper(sum))
+  {
+    std::cerr << "ERROR: vtkAttributeDataReductionFilter is not registered as associative."
+              << endl;
+    success = 0;
+  }
+  auto sumInput = MakeSumInput(rank);
+  success &=
+    CompareTreeToFlat(controller, sumInput, sum, "vtkAttributeDataReductionFilter") ? 1 : 0;
+
+  // Also check the tree reduced sums against their expected values.
+  auto sums = Reduce(controller, sumInput, sum, 2, vtkReductionFilter::REDUCE_ALL_TO_ONE, 0);
+  if (rank == 0)
+  {
+    const double rankSum = numProcs * (numProcs + 1) / 2.0;
+    for (vtkIdType cc = 0; cc < 5; ++cc)
+    {
+      if (sums->GetNumberOfRows() != 5 ||
+        sums->GetValueByName(cc, "Counts").ToDouble() != rankSum * (cc + 1))
+      {
+        std::cerr << "ERROR: unexpected tree reduced sum in bin " << cc << endl;
+        success = 0;
+        break;
+      }
+    }
+  }
+
+  int allSuccess = 0;
+  controller->AllReduce(&success, &allSuccess, 1, vtkCommunicator::LOGICAL_AND_OP);
+  vtkMultiProcessController::SetGlobalController(nullptr);
+  controller->Finalize();
+  return allSuccess ? EXIT_SUCCESS : EXIT_FAILURE;
+}
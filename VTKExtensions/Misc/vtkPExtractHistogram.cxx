@@ -19,19 +19,68 @@
 #include "vtkCommunicator.h"
 #include "vtkDataArrayRange.h"
 #include "vtkDataSet.h"
+#include "vtkDataSetAttributes.h"
 #include "vtkDoubleArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkIntArray.h"
 #include "vtkMultiProcessController.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkReductionFilter.h"
 #include "vtkSmartPointer.h"
 #include "vtkTable.h"
 
+#include <algorithm>
+#include <cstring>
+#include <functional>
 #include <string>
+#include <vector>
 #include <vtksys/RegularExpression.hxx>
 
+namespace
+{
+// Returns the row arrays that are summed across ranks, sorted by name so that
+// all ranks pack them in the same order.
+std::vector<vtkDataArray*> GetArraysToReduce(vtkTable* table, const char* excludedName)
+{
+  std::vector<vtkDataArray*> arrays;
+  vtkDataSetAttributes* rowData = table->GetRowData();
+  for (int cc = 0, max = rowData->GetNumberOfArrays(); cc < max; ++cc)
+  {
+    vtkDataArray* array = rowData->GetArray(cc);
+    if (array && array->GetName() &&
+      (!excludedName || strcmp(array->GetName(), excludedName) != 0))
+    {
+      arrays.push_back(array);
+    }
+  }
+  std::sort(arrays.begin(), arrays.end(),
+    [](vtkDataArray* a, vtkDataArray* b) { return strcmp(a->GetName(), b->GetName()) < 0; });
+  return arrays;
+}
+
+// Returns a hash of the name, type, number of components and number of tuples
+// of each array to reduce. Ranks whose arrays have the same signature can sum
+// them value by value.
+vtkTypeInt64 ComputeLayoutSignature(const std::vector<vtkDataArray*>& arrays, vtkIdType binCount)
+{
+  vtkTypeUInt64 signature = 14695981039346656037ull;
+  auto combine = [&signature](vtkTypeUInt64 value) {
+    signature ^= value + 0x9e3779b97f4a7c15ull + (signature << 6) + (signature >> 2);
+  };
+  combine(static_cast<vtkTypeUInt64>(binCount));
+  for (vtkDataArray* array : arrays)
+  {
+    combine(std::hash<std::string>()(array->GetName()));
+    combine(static_cast<vtkTypeUInt64>(array->GetDataType()));
+    combine(static_cast<vtkTypeUInt64>(array->GetNumberOfComponents()));
+    combine(static_cast<vtkTypeUInt64>(array->GetNumberOfTuples()));
+  }
+  return static_cast<vtkTypeInt64>(signature);
+}
+}
+
 vtkStandardNewMacro(vtkPExtractHistogram);
 vtkCxxSetObjectMacro(vtkPExtractHistogram, Controller, vtkMultiProcessController);
 //-----------------------------------------------------------------------------
@@ -61,13 +110,17 @@ bool vtkPExtractHistogram::GetInputArrayRange(vtkInformationVector** inputVector
   // return value in this call.
   this->Superclass::GetInputArrayRange(inputVector, local_range);
 
-  if (!this->Controller->AllReduce(&local_range[0], &range[0], 1, vtkCommunicator::MIN_OP) ||
-    !this->Controller->AllReduce(&local_range[1], &range[1], 1, vtkCommunicator::MAX_OP))
+  // reduce min and max in a single collective by negating the max.
+  double send_range[2] = { local_range[0], -local_range[1] };
+  double recv_range[2];
+  if (!this->Controller->AllReduce(send_range, recv_range, 2, vtkCommunicator::MIN_OP))
   {
     vtkErrorMacro("Parallel communication error. Could not reduce ranges.");
     return false;
   }
 
+  range[0] = recv_range[0];
+  range[1] = -recv_range[1];
   return true;
 }
 
@@ -106,35 +159,90 @@ int vtkPExtractHistogram::RequestData(
       // Nothing to do if there is no data
       return 1;
     }
-    // Now we need to collect and reduce data from all nodes on the root.
-    vtkSmartPointer<vtkReductionFilter> reduceFilter = vtkSmartPointer<vtkReductionFilter>::New();
-    reduceFilter->SetController(this->Controller);
+    // All ranks bin over the same global range, so the histograms can be
+    // summed bin by bin. Pack all the arrays to sum in a single buffer and
+    // reduce it in one collective rather than gathering the tables on the root.
+    std::vector<vtkDataArray*> arrays = ::GetArraysToReduce(output, this->BinExtentsArrayName);
+    vtkIdType localSize = 0;
+    for (vtkDataArray* array : arrays)
+    {
+      localSize += array->GetNumberOfValues();
+    }
+    // All ranks have the same layout when the minimum and the maximum of the
+    // layout signatures match, the latter being reduced as the minimum of the
+    // complement so that a single collective is enough.
+    const vtkTypeInt64 signature = ::ComputeLayoutSignature(arrays, this->BinCount);
+    vtkTypeInt64 sendSignatures[2] = { signature, ~signature };
+    vtkTypeInt64 recvSignatures[2] = { 0, 0 };
+    this->Controller->AllReduce(sendSignatures, recvSignatures, 2, vtkCommunicator::MIN_OP);
+    const bool sameLayout = (recvSignatures[0] == ~recvSignatures[1]);
 
-    if (isRoot)
+    if (sameLayout)
+    {
+      vtkNew<vtkDoubleArray> sendBuffer;
+      sendBuffer->SetNumberOfValues(localSize);
+      vtkNew<vtkDoubleArray> recvBuffer;
+      recvBuffer->SetNumberOfValues(localSize);
+      auto sendRange = vtk::DataArrayValueRange<1>(sendBuffer.Get());
+      auto sendIter = sendRange.begin();
+      for (vtkDataArray* array : arrays)
+      {
+        const auto values = vtk::DataArrayValueRange(array);
+        sendIter = std::copy(values.cbegin(), values.cend(), sendIter);
+      }
+      if (!this->Controller->Reduce(sendBuffer, recvBuffer, vtkCommunicator::SUM_OP, 0))
+      {
+        vtkErrorMacro("Parallel communication error. Could not reduce histograms.");
+        return 0;
+      }
+      if (isRoot)
+      {
+        const auto recvRange = vtk::DataArrayValueRange<1>(recvBuffer.Get());
+        auto recvIter = recvRange.cbegin();
+        for (vtkDataArray* array : arrays)
+        {
+          auto values = vtk::DataArrayValueRange(array);
+          std::copy(recvIter, recvIter + values.size(), values.begin());
+          recvIter += values.size();
+        }
+      }
+    }
+    else
     {
-      // PostGatherHelper needs to be set only on the root node.
+      // Now we need to collect and reduce data from all nodes on the root.
+      vtkSmartPointer<vtkReductionFilter> reduceFilter = vtkSmartPointer<vtkReductionFilter>::New();
+      reduceFilter->SetController(this->Controller);
+      reduceFilter->SetTreeReductionFanIn(vtkReductionFilter::DEFAULT_TREE_REDUCTION_FAN_IN);
+
+      // Summing histograms is associative, so partial sums are computed along
+      // a tree of processes. The PostGatherHelper must then be set on all ranks
+      // for them to agree on using the tree.
       vtkSmartPointer<vtkAttributeDataReductionFilter> rf =
         vtkSmartPointer<vtkAttributeDataReductionFilter>::New();
       rf->SetAttributeType(vtkAttributeDataReductionFilter::ROW_DATA);
       rf->SetReductionType(vtkAttributeDataReductionFilter::ADD);
       reduceFilter->SetPostGatherHelper(rf);
+
+      vtkSmartPointer<vtkTable> copy = vtkSmartPointer<vtkTable>::New();
+      copy->ShallowCopy(output);
+      reduceFilter->SetInputData(copy);
+      reduceFilter->Update();
+      if (isRoot)
+      {
+        // We save the old bin extents and then revert to be restored later since
+        // the reduction reduces the bin extents as well.
+        output->ShallowCopy(reduceFilter->GetOutput());
+        if (output->GetRowData()->GetNumberOfArrays() == 0)
+        {
+          vtkErrorMacro(<< "Reduced data has 0 arrays");
+          return 0;
+        }
+        output->GetRowData()->GetArray(this->BinExtentsArrayName)->DeepCopy(oldExtents);
+      }
     }
 
-    vtkSmartPointer<vtkTable> copy = vtkSmartPointer<vtkTable>::New();
-    copy->ShallowCopy(output);
-    reduceFilter->SetInputData(copy);
-    reduceFilter->Update();
     if (isRoot)
     {
-      // We save the old bin extents and then revert to be restored later since
-      // the reduction reduces the bin extents as well.
-      output->ShallowCopy(reduceFilter->GetOutput());
-      if (output->GetRowData()->GetNumberOfArrays() == 0)
-      {
-        vtkErrorMacro(<< "Reduced data has 0 arrays");
-        return 0;
-      }
-      output->GetRowData()->GetArray(this->BinExtentsArrayName)->DeepCopy(oldExtents);
       if (this->CalculateAverages)
       {
         vtkDataArray* bin_values = output->GetRowData()->GetArray(this->BinValuesArrayName);
@@ -17,7 +17,8 @@
  * @brief   Extract histogram for parallel dataset.
  *
  * vtkPExtractHistogram is vtkExtractHistogram subclass for parallel datasets.
- * It gathers the histogram data on the root node.
+ * The histograms computed on each rank over the global range are summed on
+ * the root node with a single reduction.
  */
 
 #ifndef vtkPExtractHistogram_h
@@ -39,9 +39,27 @@
 #include "vtkTable.h"
 #include "vtkTrivialProducer.h"
 
+#include <algorithm>
+#include <mutex>
+#include <set>
 #include <sstream>
+#include <string>
 #include <vector>
 
+namespace
+{
+// Filters may be executed concurrently, e.g. by different sessions or threads,
+// hence all accesses to the registry go through this mutex.
+std::mutex AssociativePostGatherHelpersMutex;
+
+std::set<std::string>& GetAssociativePostGatherHelpers()
+{
+  static std::set<std::string> helpers = { "vtkAppendFilter", "vtkAppendPolyData",
+    "vtkAttributeDataReductionFilter", "vtkPVMergeTables", "vtkPVMergeTablesMultiBlock" };
+  return helpers;
+}
+}
+
 vtkStandardNewMacro(vtkReductionFilter);
 vtkCxxSetObjectMacro(vtkReductionFilter, Controller, vtkMultiProcessController);
 vtkCxxSetObjectMacro(vtkReductionFilter, PreGatherHelper, vtkAlgorithm);
@@ -58,6 +76,7 @@ vtkReductionFilter::vtkReductionFilter()
   this->GenerateProcessIds = 0;
   this->ReductionMode = vtkReductionFilter::REDUCE_ALL_TO_ONE;
   this->ReductionProcessId = 0;
+  this->TreeReductionFanIn = 0;
 }
 
 //-----------------------------------------------------------------------------
@@ -75,6 +94,39 @@ int vtkReductionFilter::FillInputPortInformation(int idx, vtkInformation* info)
   return this->Superclass::FillInputPortInformation(idx, info);
 }
 
+//-----------------------------------------------------------------------------
+void vtkReductionFilter::RegisterAssociativePostGatherHelper(const char* className)
+{
+  if (className)
+  {
+    std::lock_guard<std::mutex> lock(AssociativePostGatherHelpersMutex);
+    GetAssociativePostGatherHelpers().insert(className);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void vtkReductionFilter::UnRegisterAssociativePostGatherHelper(const char* className)
+{
+  if (className)
+  {
+    std::lock_guard<std::mutex> lock(AssociativePostGatherHelpersMutex);
+    GetAssociativePostGatherHelpers().erase(className);
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool vtkReductionFilter::IsAssociativePostGatherHelper(vtkAlgorithm* helper)
+{
+  if (!helper)
+  {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(AssociativePostGatherHelpersMutex);
+  const auto& helpers = GetAssociativePostGatherHelpers();
+  return std::any_of(helpers.begin(), helpers.end(),
+    [helper](const std::string& name) { return helper->IsA(name.c_str()) != 0; });
+}
+
 //-----------------------------------------------------------------------------
 void vtkReductionFilter::SetPreGatherHelperName(const char* name)
 {
@@ -365,6 +417,16 @@ void vtkReductionFilter::Reduce(vtkDataObject* input, vtkDataObject* output)
     }
   }
 
+  // The decision must be the same on all ranks, hence it only depends on the
+  // filter's settings and on the output type, never on the local data.
+  if (this->TreeReductionFanIn >= 2 && this->PassThrough < 0 &&
+    !vtkSelection::SafeDownCast(output) &&
+    vtkReductionFilter::IsAssociativePostGatherHelper(this->PostGatherHelper))
+  {
+    this->TreeReduce(preOutput, output);
+    return;
+  }
+
   std::vector<vtkSmartPointer<vtkDataObject>> data_sets;
   std::vector<vtkSmartPointer<vtkDataObject>> receiveData(numProcs);
 
@@ -434,6 +496,125 @@ void vtkReductionFilter::Reduce(vtkDataObject* input, vtkDataObject* output)
     this->PostProcess(output, &data_sets[0], static_cast<unsigned int>(data_sets.size()));
   }
 }
+
+//-----------------------------------------------------------------------------
+void vtkReductionFilter::TreeReduce(vtkDataObject* preOutput, vtkDataObject* output)
+{
+  vtkMultiProcessController* controller = this->Controller;
+  const int myId = controller->GetLocalProcessId();
+  const int numProcs = controller->GetNumberOfProcesses();
+  const vtkTypeInt64 fanIn = std::min(this->TreeReductionFanIn, numProcs);
+
+  // Process 0 is the root of the tree. At each level, the processes whose id
+  // is a multiple of `span` combine their partial result with those of the
+  // following `fanIn - 1` processes still in the tree. Since each of these
+  // covers a contiguous range of process ids, inputs are always combined in
+  // process order, as with the flat gather.
+  vtkSmartPointer<vtkDataObject> partial = preOutput;
+  bool partialIsReduced = false;
+  for (vtkTypeInt64 stride = 1; stride < numProcs; stride *= fanIn)
+  {
+    const vtkTypeInt64 span = stride * fanIn;
+    if (myId % span != 0)
+    {
+      this->SendPartialReduction(partial, static_cast<int>(myId - myId % span));
+      partial = nullptr;
+      break;
+    }
+
+    std::vector<vtkSmartPointer<vtkDataObject>> inputs;
+    if (partial)
+    {
+      inputs.push_back(partial);
+    }
+    for (vtkTypeInt64 child = myId + stride; child < numProcs && child < myId + span;
+         child += stride)
+    {
+      if (auto received = this->ReceivePartialReduction(static_cast<int>(child)))
+      {
+        inputs.push_back(received);
+      }
+    }
+
+    if (inputs.size() > 1)
+    {
+      partial.TakeReference(output->NewInstance());
+      this->PostProcess(partial, &inputs[0], static_cast<unsigned int>(inputs.size()));
+      partialIsReduced = true;
+    }
+    else if (!inputs.empty())
+    {
+      partial = inputs[0];
+    }
+  }
+
+  // The root's result has not gone through the PostGatherHelper when only a
+  // single process had data.
+  if (myId == 0 && partial && !partialIsReduced)
+  {
+    vtkSmartPointer<vtkDataObject> inputs[1] = { partial };
+    partial.TakeReference(output->NewInstance());
+    this->PostProcess(partial, inputs, 1);
+  }
+
+  const int rootId = this->ReductionMode == vtkReductionFilter::REDUCE_ALL_TO_ALL
+    ? 0
+    : this->ReductionProcessId;
+  if (rootId != 0)
+  {
+    if (myId == 0)
+    {
+      this->SendPartialReduction(partial, rootId);
+    }
+    else if (myId == rootId)
+    {
+      partial = this->ReceivePartialReduction(0);
+    }
+  }
+
+  if (myId == rootId)
+  {
+    if (partial)
+    {
+      output->ShallowCopy(partial);
+    }
+  }
+  else if (preOutput && this->ReductionMode == vtkReductionFilter::REDUCE_ALL_TO_ONE)
+  {
+    vtkSmartPointer<vtkDataObject> inputs[1] = { preOutput };
+    this->PostProcess(output, inputs, 1);
+  }
+
+  if (this->ReductionMode == vtkReductionFilter::REDUCE_ALL_TO_ALL)
+  {
+    controller->Broadcast(output, rootId);
+  }
+}
+
+//-----------------------------------------------------------------------------
+void vtkReductionFilter::SendPartialReduction(vtkDataObject* data, int remoteId)
+{
+  int hasData = data ? 1 : 0;
+  this->Controller->Send(&hasData, 1, remoteId, TRANSMIT_DATA_OBJECT);
+  if (data)
+  {
+    this->Controller->Send(data, remoteId, TRANSMIT_DATA_OBJECT);
+  }
+}
+
+//-----------------------------------------------------------------------------
+vtkSmartPointer<vtkDataObject> vtkReductionFilter::ReceivePartialReduction(int remoteId)
+{
+  int hasData = 0;
+  this->Controller->Receive(&hasData, 1, remoteId, TRANSMIT_DATA_OBJECT);
+  if (!hasData)
+  {
+    return nullptr;
+  }
+  return vtkSmartPointer<vtkDataObject>::Take(
+    this->Controller->ReceiveDataObject(remoteId, TRANSMIT_DATA_OBJECT));
+}
+
 //----------------------------------------------------------------------------
 int vtkReductionFilter::GatherSelection(vtkSelection* sendData,
   std::vector<vtkSmartPointer<vtkDataObject>>& receiveData, int destProcessId)
@@ -484,4 +665,5 @@ void vtkReductionFilter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Controller: " << this->Controller << endl;
   os << indent << "PassThrough: " << this->PassThrough << endl;
   os << indent << "GenerateProcessIds: " << this->GenerateProcessIds << endl;
+  os << indent << "TreeReductionFanIn: " << this->TreeReductionFanIn << endl;
 }
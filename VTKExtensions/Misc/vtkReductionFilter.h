@@ -28,6 +28,12 @@
  * In addition to doing reduction the PassThrough variable lets you choose
  * to pass through the results of any one node instead of aggregating all of
  * them together.
+ *
+ * When the PostGatherHelper is associative (see
+ * RegisterAssociativePostGatherHelper) and TreeReductionFanIn is 2 or more,
+ * the intermediate results are instead combined along a tree of processes,
+ * running the PostGatherHelper at every level of the tree, so that no single
+ * process has to receive and hold the results of all the others.
  */
 
 #ifndef vtkReductionFilter_h
@@ -125,11 +131,49 @@ public:
   vtkGetMacro(GenerateProcessIds, int);
   ///@}
 
+  ///@{
+  /**
+   * Get/Set the fan-in of the reduction tree. When set to 2 or more, and the
+   * PostGatherHelper is associative, each process combines its result with
+   * those of at most TreeReductionFanIn - 1 other processes and forwards the
+   * partial reduction up the tree, instead of every process sending its
+   * result to the reduction process. Results are always combined in process
+   * order. Ignored when PassThrough is set or when reducing vtkSelection.
+   * Default is 0 i.e. gather all results on the reduction process.
+   * DEFAULT_TREE_REDUCTION_FAN_IN is the value used by ParaView's own filters
+   * and views that enable tree reduction.
+   */
+  vtkSetClampMacro(TreeReductionFanIn, int, 0, VTK_INT_MAX);
+  vtkGetMacro(TreeReductionFanIn, int);
+  ///@}
+
+  ///@{
+  /**
+   * Declare that the algorithm class `className`, and its subclasses, is an
+   * associative PostGatherHelper i.e. running it on partial reductions of
+   * consecutive processes produces the same result as running it once on all
+   * the results. Only such helpers are used for tree reduction.
+   * vtkAppendFilter, vtkAppendPolyData, vtkAttributeDataReductionFilter,
+   * vtkPVMergeTables and vtkPVMergeTablesMultiBlock are registered by default.
+   * vtkAttributeDataReductionFilter is associative as long as all the
+   * processes produce the same number of tuples, which is the case of the
+   * histograms it is used to reduce. These functions are thread safe.
+   */
+  static void RegisterAssociativePostGatherHelper(const char* className);
+  static void UnRegisterAssociativePostGatherHelper(const char* className);
+  static bool IsAssociativePostGatherHelper(vtkAlgorithm* helper);
+  ///@}
+
   enum Tags
   {
     TRANSMIT_DATA_OBJECT = 23484
   };
 
+  enum
+  {
+    DEFAULT_TREE_REDUCTION_FAN_IN = 8
+  };
+
 protected:
   vtkReductionFilter();
   ~vtkReductionFilter() override;
@@ -156,6 +200,20 @@ protected:
   int GatherSelection(vtkSelection* sendData,
     std::vector<vtkSmartPointer<vtkDataObject>>& receiveData, int destProcessId);
 
+  /**
+   * Reduce along a tree of processes with fan-in TreeReductionFanIn.
+   * Called instead of gathering when tree reduction applies.
+   */
+  void TreeReduce(vtkDataObject* preOutput, vtkDataObject* output);
+
+  ///@{
+  /**
+   * Send/receive a possibly null partial reduction to/from another process.
+   */
+  void SendPartialReduction(vtkDataObject* data, int remoteId);
+  vtkSmartPointer<vtkDataObject> ReceivePartialReduction(int remoteId);
+  ///@}
+
   vtkAlgorithm* PreGatherHelper;
   vtkAlgorithm* PostGatherHelper;
   vtkMultiProcessController* Controller;
@@ -163,6 +221,7 @@ protected:
   int GenerateProcessIds;
   int ReductionMode;
   int ReductionProcessId;
+  int TreeReductionFanIn;
 
 private:
   vtkReductionFilter(const vtkReductionFilter&) = delete;
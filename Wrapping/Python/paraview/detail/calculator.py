@@ -16,6 +16,7 @@ from vtkmodules.numpy_interface.algorithms import *
 from paraview.vtk import vtkDataObject, vtkDoubleArray, vtkSelectionNode, vtkSelection, vtkStreamingDemandDrivenPipeline
 from paraview.modules import vtkPVVTKExtensionsFiltersPython
 from paraview.vtk.util.numpy_support import get_numpy_array_type
+import functools
 import sys
 
 if sys.version_info >= (3,):
@@ -134,6 +135,16 @@ def cellContainsPoint(inputs, locations):
     return output.CellData.GetArray('vtkInsidedness')
 
 
+@functools.lru_cache(maxsize=128)
+def compile_expression(expression):
+    """Returns the code objects for the ' and ' separated sub-expressions of
+    `expression`. Results are cached so that an expression is only parsed once
+    and not on every execution of the filter."""
+    # `eval` strips leading and trailing spaces and tabs from strings, `compile` does not.
+    return tuple(compile(subEx.strip(' \t'), "<calculator>", "eval")
+                 for subEx in expression.split(' and '))
+
+
 def compute(inputs, expression, ns=None):
     #  build the locals environment used to eval the expression.
     mylocals = dict()
@@ -146,10 +157,14 @@ def compute(inputs, expression, ns=None):
         pass
 
     finalRet = None
-    for subEx in expression.split(' and '):
-        retVal = eval(subEx, globals(), mylocals)
+    for code in compile_expression(expression):
+        retVal = eval(code, globals(), mylocals)
         if finalRet is None:
             finalRet = retVal
+        elif isinstance(finalRet, np.ndarray) and isinstance(retVal, np.ndarray) and \
+                finalRet.shape == retVal.shape:
+            # element-wise, without iterating over the values in Python.
+            finalRet = dsa.VTKArray(np.asarray(finalRet) & np.asarray(retVal))
         else:
             finalRet = dsa.VTKArray([a & b for a, b in zip(finalRet, retVal)])
 
@@ -216,7 +231,10 @@ def execute(self, expression):
         # Convert the result array type if requested.
         if self.GetResultArrayType() != -1:
             # handles VTKArray and VTKCompositeDataArray
-            if hasattr(retVal, "astype"):
+            if isinstance(retVal, np.ndarray):
+                # avoid copying the result when it already has the requested type.
+                vtkRet = retVal.astype(get_numpy_array_type(self.GetResultArrayType()), copy=False)
+            elif hasattr(retVal, "astype"):
                 vtkRet = retVal.astype(get_numpy_array_type(self.GetResultArrayType()))
             else:
                 # we can also get a scalar, convert to single element array of correct type